@@ -0,0 +1,59 @@
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../../include/string_interpolation.hpp"
+
+// compiles the same patterns from text and loads them from a bundle, as a service does at startup
+int main()
+{
+    constexpr std::size_t templateCount = 20000;
+    std::vector<std::string> names;
+    std::vector<std::string> patterns;
+    for (std::size_t index = 0; index < templateCount; ++index) {
+        names.push_back("templates/" + std::to_string(index) + ".txt");
+        std::string pattern = "Dear {{name}}, your order {{order}} of " + std::to_string(index) + " items ";
+        while (pattern.size() < 1024) {
+            pattern += "ships on {{date}} to {{address}}, the total is {{total}}. ";
+        }
+        patterns.push_back(std::move(pattern));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<istr::StringTemplate> compiled;
+    compiled.reserve(templateCount);
+    for (const std::string& pattern: patterns) {
+        compiled.emplace_back(pattern);
+    }
+    const std::chrono::duration<double, std::milli> compiling = std::chrono::steady_clock::now() - start;
+
+    istr::TemplateBundleWriter writer;
+    for (std::size_t index = 0; index < templateCount; ++index) {
+        writer.putTemplate(names[index], compiled[index]);
+    }
+    std::ostringstream output;
+    writer.writeTo(output);
+    const std::string serialized = output.str();
+    std::vector<std::byte> mapped(serialized.size());
+    std::memcpy(mapped.data(), serialized.data(), serialized.size());
+
+    start = std::chrono::steady_clock::now();
+    const auto bundle = istr::TemplateBundle::load(mapped);
+    const std::chrono::duration<double, std::milli> loading = std::chrono::steady_clock::now() - start;
+    if (!bundle) {
+        std::cout << "the bundle could not be loaded" << std::endl;
+        return 1;
+    }
+
+    const istr::StringTemplate::Arguments arguments{{"name", "Harry"}, {"order", "42"}, {"date", "monday"},
+                                                    {"address", "4 Privet Drive"}, {"total", "7 galleons"}};
+    const std::size_t index = bundle->findTemplate(names[templateCount / 2]);
+    const bool same = bundle->getTemplate(index).render(arguments) == compiled[templateCount / 2].render(arguments);
+    std::cout << templateCount << " templates, bundle of " << serialized.size() << " bytes" << std::endl;
+    std::cout << "  compiling from text : " << compiling.count() << " ms" << std::endl;
+    std::cout << "  loading the bundle : " << loading.count() << " ms" << std::endl;
+    std::cout << "  same rendering : " << (same ? "yes" : "no") << std::endl;
+    return same ? 0 : 1;
+}
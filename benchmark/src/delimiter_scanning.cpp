@@ -0,0 +1,103 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../include/string_interpolation.hpp"
+
+struct Delimiters {
+    std::string open;
+    std::string close;
+};
+
+std::string makePattern(std::size_t size, const Delimiters& delimiters, std::string_view filler,
+                        std::vector<std::string>& replaceables)
+{
+    std::string pattern;
+    pattern.reserve(size);
+    for (std::size_t index = 0; pattern.size() < size; ++index) {
+        pattern += filler;
+        if (index % 8 == 0) {
+            replaceables.push_back(delimiters.open + "argument" + std::to_string(index) + delimiters.close);
+            pattern += replaceables.back();
+        }
+    }
+    return pattern;
+}
+
+template<typename Find>
+std::size_t countPlaceholders(std::string_view pattern, const Delimiters& delimiters, Find&& find)
+{
+    std::size_t count = 0;
+    std::size_t open = 0;
+    while ((open = find(pattern, delimiters.open, open)) != std::string_view::npos) {
+        const std::size_t close = find(pattern, delimiters.close, open + delimiters.open.size());
+        if (close == std::string_view::npos) {
+            break;
+        }
+        ++count;
+        open = close + delimiters.close.size();
+    }
+    return count;
+}
+
+template<typename Scan>
+void measure(const std::string& name, std::size_t bytes, Scan&& scan)
+{
+    const std::size_t repetitions = std::max<std::size_t>(1, (256u << 20) / bytes);
+    std::size_t checksum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t repetition = 0; repetition < repetitions; ++repetition) {
+        checksum += scan();
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "  " << name << " : " << static_cast<double>(bytes * repetitions) / elapsed.count() / 1e9
+              << " GB/s (checksum " << checksum << ")" << std::endl;
+}
+
+int main()
+{
+    const std::vector<Delimiters> delimiters{{"{{", "}}"}, {"--", "))"}, {"<%=", "%>"}};
+    const std::vector<std::string_view> fillers{
+            "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt. ",
+            "{ \"id\": 1, \"tags\": [\"a-b\", \"c-d\"], \"range\": (1, 2), \"ratio\": 0.5, \"pct\": \"5%\" }, "};
+    for (const std::size_t size: {std::size_t(50) << 10, std::size_t(200) << 10}) {
+        for (const std::string_view filler: fillers) {
+        for (const Delimiters& delimiter: delimiters) {
+            std::vector<std::string> replaceables;
+            const std::string pattern = makePattern(size, delimiter, filler, replaceables);
+            std::cout << (filler.front() == '{' ? "json" : "text") << " pattern of " << pattern.size()
+                      << " bytes with " << replaceables.size()
+                      << " placeholders, delimiters " << delimiter.open << " " << delimiter.close << std::endl;
+
+            // the previous substitution searched the whole pattern once for every argument
+            measure("find per argument", pattern.size(), [&]() {
+                std::size_t found = 0;
+                for (const std::string& replaceable: replaceables) {
+                    found += pattern.find(replaceable) != std::string::npos;
+                }
+                return found;
+            });
+            measure("scalar scanner", pattern.size(), [&]() {
+                return countPlaceholders(pattern, delimiter, istr::BasicDelimiterScanner<char>::findScalar);
+            });
+#if defined(STRING_INTERPOLATION_SIMD)
+            measure("sse2 scanner", pattern.size(), [&]() {
+                return countPlaceholders(pattern, delimiter, istr::BasicDelimiterScanner<char>::findSse2);
+            });
+            if (istr::BasicDelimiterScanner<char>::isAvx2Supported()) {
+                measure("avx2 scanner", pattern.size(), [&]() {
+                    return countPlaceholders(pattern, delimiter, istr::BasicDelimiterScanner<char>::findAvx2);
+                });
+            }
+#endif
+            measure("dispatching scanner", pattern.size(), [&]() {
+                return countPlaceholders(pattern, delimiter, istr::BasicDelimiterScanner<char>::find);
+            });
+            measure("compiled template", pattern.size(), [&]() {
+                return istr::StringTemplate(pattern, delimiter.open, delimiter.close).getPlaceholders().size();
+            });
+        }
+        }
+    }
+    return 0;
+}
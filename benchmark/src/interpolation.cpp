@@ -0,0 +1,297 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <version>
+#if defined(__cpp_lib_format)
+#include <format>
+#include <iterator>
+#endif
+#include "../../include/string_interpolation.hpp"
+
+// every allocation of the process goes through here, so allocations/op covers the library and the standard library.
+// The whole set of replaceable operators is replaced, so every new is paired with the matching delete
+static std::size_t allocationCount = 0;
+
+static void* allocate(std::size_t size, std::align_val_t alignment = std::align_val_t(__STDCPP_DEFAULT_NEW_ALIGNMENT__)) noexcept
+{
+    ++allocationCount;
+    const std::size_t bytes = size == 0 ? 1 : size;
+    if (alignment <= std::align_val_t(__STDCPP_DEFAULT_NEW_ALIGNMENT__)) {
+        return std::malloc(bytes);
+    }
+    const std::size_t alignmentBytes = static_cast<std::size_t>(alignment);
+    return std::aligned_alloc(alignmentBytes, (bytes + alignmentBytes - 1) / alignmentBytes * alignmentBytes);
+}
+
+static void* allocateOrThrow(std::size_t size, std::align_val_t alignment = std::align_val_t(__STDCPP_DEFAULT_NEW_ALIGNMENT__))
+{
+    if (void* pointer = allocate(size, alignment)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size) { return allocateOrThrow(size); }
+void* operator new[](std::size_t size) { return allocateOrThrow(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return allocateOrThrow(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return allocateOrThrow(size, alignment); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocate(size, alignment);
+}
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocate(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { std::free(pointer); }
+
+struct Delimiters {
+    std::string open;
+    std::string close;
+};
+
+struct Configuration {
+    std::size_t patternSize;
+    std::size_t placeholderCount;
+    Delimiters delimiters;
+    std::size_t valueSize;
+};
+
+// the pattern split into the literals between the placeholders, literals.size() == names.size() + 1
+struct Workload {
+    std::string pattern;
+    std::vector<std::string> literals;
+    std::vector<std::string> names;
+    istr::StringInterpolation::Arguments arguments;
+    istr::StringInterpolation::Arguments otherArguments;
+};
+
+struct Result {
+    std::string operation;
+    Configuration configuration;
+    std::size_t actualPatternSize;
+    double nanosecondsPerOperation;
+    double bytesPerSecond;
+    double allocationsPerOperation;
+};
+
+Workload makeWorkload(const Configuration& configuration)
+{
+    static constexpr std::string_view filler =
+            "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt. ";
+    Workload workload;
+    for (std::size_t index = 0; index < configuration.placeholderCount; ++index) {
+        workload.names.push_back("argument" + std::to_string(index));
+    }
+    std::size_t placeholderBytes = 0;
+    for (const std::string& name: workload.names) {
+        placeholderBytes += configuration.delimiters.open.size() + name.size() + configuration.delimiters.close.size();
+    }
+    const std::size_t literalBytes = configuration.patternSize > placeholderBytes ?
+                                     configuration.patternSize - placeholderBytes : 0;
+    const std::size_t literalCount = workload.names.size() + 1;
+    for (std::size_t index = 0; index < literalCount; ++index) {
+        std::string literal;
+        const std::size_t literalSize = literalBytes / literalCount + (index < literalBytes % literalCount);
+        while (literal.size() < literalSize) {
+            literal += filler.substr(0, literalSize - literal.size());
+        }
+        workload.literals.push_back(std::move(literal));
+    }
+    workload.pattern = workload.literals.front();
+    for (std::size_t index = 0; index < workload.names.size(); ++index) {
+        workload.pattern += configuration.delimiters.open + workload.names[index] + configuration.delimiters.close;
+        workload.pattern += workload.literals[index + 1];
+    }
+    for (const std::string& name: workload.names) {
+        workload.arguments[name] = std::string(configuration.valueSize, 'a');
+        workload.otherArguments[name] = std::string(configuration.valueSize, 'b');
+    }
+    return workload;
+}
+
+// runs the operation for at least the time budget and returns the totals of the measured runs
+template<typename Operation>
+Result measure(const std::string& name, const Configuration& configuration, const Workload& workload,
+               Operation&& operation)
+{
+    static constexpr std::chrono::milliseconds budget(50);
+    static volatile std::size_t sink = 0;
+    sink = sink + operation();
+    std::size_t operations = 0;
+    std::size_t bytes = 0;
+    const std::size_t allocationsBefore = allocationCount;
+    const auto start = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::duration elapsed{};
+    do {
+        for (std::size_t repetition = 0; repetition < 16; ++repetition) {
+            bytes += operation();
+        }
+        operations += 16;
+        elapsed = std::chrono::steady_clock::now() - start;
+    } while (elapsed < budget);
+    const std::size_t allocations = allocationCount - allocationsBefore;
+    sink = sink + bytes;
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    return {name, configuration, workload.pattern.size(), seconds * 1e9 / static_cast<double>(operations),
+            static_cast<double>(bytes) / seconds,
+            static_cast<double>(allocations) / static_cast<double>(operations)};
+}
+
+// every operation returns the bytes it consumed or produced, the pattern for the construction, the argument values
+// for the puts and the output for the renders, which also keeps the work observable
+std::vector<Result> run(const Configuration& configuration)
+{
+    const Workload workload = makeWorkload(configuration);
+    const Delimiters& delimiters = configuration.delimiters;
+    std::vector<Result> results;
+
+    results.push_back(measure("construction", configuration, workload, [&]() {
+        istr::StringInterpolation interpolation(workload.pattern, delimiters.open, delimiters.close);
+        return interpolation.getPattern().size();
+    }));
+
+    istr::StringInterpolation interpolation(workload.pattern, delimiters.open, delimiters.close);
+    bool other = false;
+    results.push_back(measure("putPatternArguments", configuration, workload, [&]() {
+        other = !other;
+        interpolation.putPatternArguments(other ? workload.otherArguments : workload.arguments);
+        return configuration.placeholderCount * configuration.valueSize;
+    }));
+    results.push_back(measure("putPatternArgument", configuration, workload, [&]() {
+        other = !other;
+        interpolation.putPatternArgument(workload.names.front(), other ? workload.otherArguments.begin()->second :
+                                                                 workload.arguments.begin()->second);
+        return configuration.valueSize;
+    }));
+
+    results.push_back(measure("getSubstituted first", configuration, workload, [&]() {
+        istr::StringInterpolation fresh(workload.pattern, delimiters.open, delimiters.close);
+        fresh.putPatternArguments(workload.arguments);
+        return fresh.getSubstituted().size();
+    }));
+    results.push_back(measure("getSubstituted one argument changed", configuration, workload, [&]() {
+        other = !other;
+        interpolation.putPatternArgument(workload.names.front(), other ? workload.otherArguments.begin()->second :
+                                                                 workload.arguments.begin()->second);
+        return interpolation.getSubstituted().size();
+    }));
+    results.push_back(measure("getSubstituted cached", configuration, workload, [&]() {
+        return interpolation.getSubstituted().size();
+    }));
+
+    const istr::StringTemplate compiledTemplate(workload.pattern, delimiters.open, delimiters.close);
+    results.push_back(measure("StringTemplate::render", configuration, workload, [&]() {
+        return compiledTemplate.render(workload.arguments).size();
+    }));
+
+    const std::vector<const std::string*> values = [&]() {
+        std::vector<const std::string*> values;
+        for (const std::string& name: workload.names) {
+            values.push_back(&workload.arguments.at(name));
+        }
+        return values;
+    }();
+    results.push_back(measure("baseline concatenation", configuration, workload, [&]() {
+        std::string output = workload.literals.front();
+        for (std::size_t index = 0; index < values.size(); ++index) {
+            output += *values[index];
+            output += workload.literals[index + 1];
+        }
+        return output.size();
+    }));
+#if defined(__cpp_lib_format)
+    results.push_back(measure("baseline std::format", configuration, workload, [&]() {
+        std::string output = std::format("{}", workload.literals.front());
+        for (std::size_t index = 0; index < values.size(); ++index) {
+            std::format_to(std::back_inserter(output), "{}{}", *values[index], workload.literals[index + 1]);
+        }
+        return output.size();
+    }));
+#endif
+    return results;
+}
+
+void printText(const std::vector<Result>& results)
+{
+    for (const Result& result: results) {
+        std::cout << result.operation << " : pattern " << result.actualPatternSize << " B, "
+                  << result.configuration.placeholderCount << " placeholders, delimiters "
+                  << result.configuration.delimiters.open << " " << result.configuration.delimiters.close
+                  << ", values " << result.configuration.valueSize << " B : "
+                  << result.nanosecondsPerOperation << " ns/op, "
+                  << result.bytesPerSecond / 1e6 << " MB/s, "
+                  << result.allocationsPerOperation << " allocations/op" << std::endl;
+    }
+}
+
+void printJson(const std::vector<Result>& results)
+{
+    std::cout << "{\n  \"benchmarks\": [";
+    for (std::size_t index = 0; index < results.size(); ++index) {
+        const Result& result = results[index];
+        std::cout << (index == 0 ? "\n" : ",\n")
+                  << "    {\"operation\": \"" << result.operation << "\""
+                  << ", \"pattern_bytes\": " << result.actualPatternSize
+                  << ", \"placeholders\": " << result.configuration.placeholderCount
+                  << ", \"open_delimiter\": \"" << result.configuration.delimiters.open << "\""
+                  << ", \"close_delimiter\": \"" << result.configuration.delimiters.close << "\""
+                  << ", \"value_bytes\": " << result.configuration.valueSize
+                  << ", \"ns_per_op\": " << result.nanosecondsPerOperation
+                  << ", \"bytes_per_second\": " << result.bytesPerSecond
+                  << ", \"allocations_per_op\": " << result.allocationsPerOperation << "}";
+    }
+    std::cout << "\n  ]\n}" << std::endl;
+}
+
+// usage : interpolation [--json], the json report is written to the standard output
+int main(int argc, char** argv)
+{
+    const bool json = argc > 1 && std::string_view(argv[1]) == "--json";
+    const Configuration base{10 << 10, 10, {"{{", "}}"}, 16};
+
+    std::vector<Configuration> configurations;
+    for (const std::size_t patternSize: {std::size_t(100), std::size_t(10) << 10, std::size_t(1) << 20}) {
+        configurations.push_back({patternSize, base.placeholderCount, base.delimiters, base.valueSize});
+    }
+    for (const std::size_t placeholderCount: {1, 100, 1000}) {
+        configurations.push_back({base.patternSize, placeholderCount, base.delimiters, base.valueSize});
+    }
+    for (const Delimiters& delimiters: {Delimiters{"$", "$"}, Delimiters{"<%=", "%>"}, Delimiters{"<<<<", ">>>>"}}) {
+        configurations.push_back({base.patternSize, base.placeholderCount, delimiters, base.valueSize});
+    }
+    for (const std::size_t valueSize: {1, 256, 4096}) {
+        configurations.push_back({base.patternSize, base.placeholderCount, base.delimiters, valueSize});
+    }
+
+    std::vector<Result> results;
+    for (const Configuration& configuration: configurations) {
+        std::vector<Result> configurationResults = run(configuration);
+        if (!json) {
+            printText(configurationResults);
+        }
+        results.insert(results.end(), configurationResults.begin(), configurationResults.end());
+    }
+    if (json) {
+        printJson(results);
+    }
+    return 0;
+}
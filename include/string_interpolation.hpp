@@ -1,15 +1,46 @@
 #ifndef STRING_INTERPOLATION_H
 #define STRING_INTERPOLATION_H
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <chrono>
 #include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
 #include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <istream>
+#include <latch>
+#include <ostream>
+#include <shared_mutex>
+#include <span>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 #include <cassert>
-#include <sstream>
-#include <iostream>
 
-#if !defined(__PRETTY_FUNCTION__) && !defined(__GNUC__)
-#define __PRETTY_FUNCTION__ __FUNCSIG__
+#if !defined(STRING_INTERPOLATION_DISABLE_SIMD) && defined(__GNUC__) && defined(__x86_64__)
+#define STRING_INTERPOLATION_SIMD
+#include <immintrin.h>
+#endif
+
+#if __has_include(<unistd.h>)
+#include <cerrno>
+#include <unistd.h>
 #endif
 
 
@@ -25,82 +56,2992 @@ namespace istr {
     concept CharTypes = std::is_same<Type, char>::value;
 #endif
 
-    enum class SubstitutionPreparationModes {
-        WITH_REPLACEMENT_VALIDATION,
-        WITHOUT_REPLACEMENT_VALIDATION
-    };
+    enum class SubstitutionPreparationModes {
+        WITH_REPLACEMENT_VALIDATION,
+        WITHOUT_REPLACEMENT_VALIDATION
+    };
+
+    enum class BatchExecutionModes {
+        SEQUENTIAL,
+        PARALLEL
+    };
+
+    enum class SegmentKinds {
+        LITERAL,
+        PLACEHOLDER
+    };
+
+    enum class ArgumentProviderModes {
+        EVALUATE_EVERY_SUBSTITUTION,
+        EVALUATE_ONCE
+    };
+
+    template<CharTypes T>
+    class BasicDelimiterScanner {
+    public:
+        static std::size_t find(std::basic_string_view<T> text, std::basic_string_view<T> delimiter,
+                                std::size_t position) noexcept;
+
+        static std::size_t findScalar(std::basic_string_view<T> text, std::basic_string_view<T> delimiter,
+                                      std::size_t position) noexcept;
+
+#if defined(STRING_INTERPOLATION_SIMD)
+        static std::size_t findSse2(std::basic_string_view<T> text, std::basic_string_view<T> delimiter,
+                                    std::size_t position) noexcept requires std::is_same_v<T, char>;
+
+        __attribute__((target("avx2")))
+        static std::size_t findAvx2(std::basic_string_view<T> text, std::basic_string_view<T> delimiter,
+                                    std::size_t position) noexcept requires std::is_same_v<T, char>;
+
+        static bool isAvx2Supported() noexcept;
+#endif
+
+    private:
+        static constexpr std::size_t denseMissDistance = 64;
+    };
+
+    // the first delimiter character is looked up with the memchr of the standard library, which is the fastest
+    // while that character is rare, as in prose. Once it turns up without the rest of the delimiter within a block
+    // of the previous search, as the braces of JSON do, the vector scanners take over and filter on the first and
+    // the last character together
+    template<CharTypes T>
+    std::size_t BasicDelimiterScanner<T>::find(std::basic_string_view<T> text, std::basic_string_view<T> delimiter,
+                                               std::size_t position) noexcept {
+        if (delimiter.empty()) {
+            return findScalar(text, delimiter, position);
+        }
+        using Traits = typename std::basic_string_view<T>::traits_type;
+        const std::size_t length = delimiter.length();
+        while (position < text.length() && text.length() - position >= length) {
+            const T* candidate = Traits::find(text.data() + position, text.length() - position - length + 1,
+                                              delimiter.front());
+            if (candidate == nullptr) {
+                return std::basic_string_view<T>::npos;
+            }
+            if (Traits::compare(candidate, delimiter.data(), length) == 0) {
+                return static_cast<std::size_t>(candidate - text.data());
+            }
+            const std::size_t miss = static_cast<std::size_t>(candidate - text.data());
+            const bool dense = miss - position < denseMissDistance;
+            position = miss + 1;
+            if (dense) {
+                break;
+            }
+        }
+#if defined(STRING_INTERPOLATION_SIMD)
+        if constexpr (std::is_same_v<T, char>) {
+            return isAvx2Supported() ? findAvx2(text, delimiter, position) : findSse2(text, delimiter, position);
+        }
+#endif
+        return findScalar(text, delimiter, position);
+    }
+
+    template<CharTypes T>
+    std::size_t BasicDelimiterScanner<T>::findScalar(std::basic_string_view<T> text, std::basic_string_view<T> delimiter,
+                                                     std::size_t position) noexcept {
+        return text.find(delimiter, position);
+    }
+
+#if defined(STRING_INTERPOLATION_SIMD)
+    // both scanners compare the first and the last delimiter character over a whole block
+    // and only verify the remaining characters at the positions where both match
+    template<CharTypes T>
+    std::size_t BasicDelimiterScanner<T>::findSse2(std::basic_string_view<T> text, std::basic_string_view<T> delimiter,
+                                                   std::size_t position) noexcept requires std::is_same_v<T, char> {
+        const std::size_t length = delimiter.length();
+        if (length == 0 || position > text.length() || text.length() - position < length) {
+            return findScalar(text, delimiter, position);
+        }
+        const __m128i first = _mm_set1_epi8(delimiter.front());
+        const __m128i last = _mm_set1_epi8(delimiter.back());
+        const auto matchBlock = [&](std::size_t offset) {
+            const __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + offset));
+            const __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + offset + length - 1));
+            return static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(
+                    _mm_and_si128(_mm_cmpeq_epi8(first, blockFirst), _mm_cmpeq_epi8(last, blockLast)))));
+        };
+        for (; position + length - 1 + 64 <= text.length(); position += 64) {
+            std::uint64_t mask = matchBlock(position) | matchBlock(position + 16) << 16 |
+                                 matchBlock(position + 32) << 32 | matchBlock(position + 48) << 48;
+            for (; mask != 0; mask &= mask - 1) {
+                const std::size_t candidate = position + static_cast<std::size_t>(__builtin_ctzll(mask));
+                if (length <= 2 || text.compare(candidate + 1, length - 2, delimiter.substr(1, length - 2)) == 0) {
+                    return candidate;
+                }
+            }
+        }
+        return findScalar(text, delimiter, position);
+    }
+
+    template<CharTypes T>
+    __attribute__((target("avx2")))
+    std::size_t BasicDelimiterScanner<T>::findAvx2(std::basic_string_view<T> text, std::basic_string_view<T> delimiter,
+                                                   std::size_t position) noexcept requires std::is_same_v<T, char> {
+        const std::size_t length = delimiter.length();
+        if (length == 0 || position > text.length() || text.length() - position < length) {
+            return findScalar(text, delimiter, position);
+        }
+        const __m256i first = _mm256_set1_epi8(delimiter.front());
+        const __m256i last = _mm256_set1_epi8(delimiter.back());
+        const auto matchBlock = [&](std::size_t offset) __attribute__((target("avx2"))) {
+            const __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text.data() + offset));
+            const __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text.data() + offset + length - 1));
+            return static_cast<std::uint64_t>(static_cast<unsigned>(_mm256_movemask_epi8(
+                    _mm256_and_si256(_mm256_cmpeq_epi8(first, blockFirst), _mm256_cmpeq_epi8(last, blockLast)))));
+        };
+        for (; position + length - 1 + 64 <= text.length(); position += 64) {
+            std::uint64_t mask = matchBlock(position) | matchBlock(position + 32) << 32;
+            for (; mask != 0; mask &= mask - 1) {
+                const std::size_t candidate = position + static_cast<std::size_t>(__builtin_ctzll(mask));
+                if (length <= 2 || text.compare(candidate + 1, length - 2, delimiter.substr(1, length - 2)) == 0) {
+                    return candidate;
+                }
+            }
+        }
+        return findSse2(text, delimiter, position);
+    }
+
+    template<CharTypes T>
+    bool BasicDelimiterScanner<T>::isAvx2Supported() noexcept {
+        static const bool supported = __builtin_cpu_supports("avx2");
+        return supported;
+    }
+#endif
+
+    template<typename V, CharTypes T>
+    struct Formatter;
+
+    template<typename V, typename T>
+    concept Formattable = requires(const V& value, T* output) {
+        { Formatter<V, T>::getSize(value) } -> std::convertible_to<std::size_t>;
+        { Formatter<V, T>::format(output, value) } -> std::same_as<T*>;
+    };
+
+    template<typename V, CharTypes T> requires std::convertible_to<const V&, std::basic_string_view<T>>
+    struct Formatter<V, T> {
+        static std::size_t getSize(const V& value) noexcept {
+            return std::basic_string_view<T>(value).length();
+        }
+
+        static T* format(T* output, const V& value) noexcept {
+            const std::basic_string_view<T> view(value);
+            return std::copy(view.begin(), view.end(), output);
+        }
+    };
+
+    template<CharTypes T>
+    struct Formatter<T, T> {
+        static std::size_t getSize(const T&) noexcept {
+            return 1;
+        }
+
+        static T* format(T* output, const T& value) noexcept {
+            *output = value;
+            return output + 1;
+        }
+    };
+
+    template<CharTypes T>
+    struct Formatter<bool, T> {
+        static std::size_t getSize(const bool& value) noexcept {
+            return value ? 4 : 5;
+        }
+
+        static T* format(T* output, const bool& value) noexcept {
+            const std::string_view text = value ? "true" : "false";
+            return std::copy(text.begin(), text.end(), output);
+        }
+    };
+
+    template<typename V, CharTypes T> requires std::integral<V> && (!CharTypes<V>) && (!std::same_as<V, bool>)
+    struct Formatter<V, T> {
+        static std::size_t getSize(const V& value) noexcept {
+            std::size_t size = value < 0 ? 2 : 1;
+            for (V rest = value / 10; rest != 0; rest /= 10) {
+                ++size;
+            }
+            return size;
+        }
+
+        static T* format(T* output, const V& value) noexcept {
+            if constexpr (std::is_same_v<T, char>) {
+                return std::to_chars(output, output + getSize(value), value).ptr;
+            } else {
+                char buffer[std::numeric_limits<V>::digits10 + 3];
+                char* end = std::to_chars(std::begin(buffer), std::end(buffer), value).ptr;
+                return std::copy(std::begin(buffer), end, output);
+            }
+        }
+    };
+
+    // a floating point value converted once, its size and its characters come from the same to_chars call
+    template<std::floating_point V>
+    struct FloatingPointCharacters {
+        explicit FloatingPointCharacters(const V& value) noexcept :
+                length(static_cast<std::size_t>(
+                        std::to_chars(std::begin(this->characters), std::end(this->characters), value).ptr -
+                        std::begin(this->characters))) {
+        }
+
+        char characters[64];
+        std::size_t length;
+    };
+
+    template<std::floating_point V, CharTypes T>
+    struct Formatter<FloatingPointCharacters<V>, T> {
+        static std::size_t getSize(const FloatingPointCharacters<V>& value) noexcept {
+            return value.length;
+        }
+
+        static T* format(T* output, const FloatingPointCharacters<V>& value) noexcept {
+            return std::copy(value.characters, value.characters + value.length, output);
+        }
+    };
+
+    template<std::floating_point V, CharTypes T>
+    struct Formatter<V, T> {
+        static std::size_t getSize(const V& value) noexcept {
+            return FloatingPointCharacters<V>(value).length;
+        }
+
+        static T* format(T* output, const V& value) noexcept {
+            return Formatter<FloatingPointCharacters<V>, T>::format(output, FloatingPointCharacters<V>(value));
+        }
+    };
+
+    // the unit std::format writes after the count of a duration, "[num]s" or "[num/den]s" for a period without one
+    template<typename Period>
+    struct DurationSuffix {
+        static constexpr std::string_view get() noexcept {
+            if constexpr (std::is_same_v<Period, std::atto>) {
+                return "as";
+            } else if constexpr (std::is_same_v<Period, std::femto>) {
+                return "fs";
+            } else if constexpr (std::is_same_v<Period, std::pico>) {
+                return "ps";
+            } else if constexpr (std::is_same_v<Period, std::nano>) {
+                return "ns";
+            } else if constexpr (std::is_same_v<Period, std::micro>) {
+                return "us";
+            } else if constexpr (std::is_same_v<Period, std::milli>) {
+                return "ms";
+            } else if constexpr (std::is_same_v<Period, std::centi>) {
+                return "cs";
+            } else if constexpr (std::is_same_v<Period, std::deci>) {
+                return "ds";
+            } else if constexpr (std::is_same_v<Period, std::ratio<1>>) {
+                return "s";
+            } else if constexpr (std::is_same_v<Period, std::deca>) {
+                return "das";
+            } else if constexpr (std::is_same_v<Period, std::hecto>) {
+                return "hs";
+            } else if constexpr (std::is_same_v<Period, std::kilo>) {
+                return "ks";
+            } else if constexpr (std::is_same_v<Period, std::mega>) {
+                return "Ms";
+            } else if constexpr (std::is_same_v<Period, std::giga>) {
+                return "Gs";
+            } else if constexpr (std::is_same_v<Period, std::tera>) {
+                return "Ts";
+            } else if constexpr (std::is_same_v<Period, std::peta>) {
+                return "Ps";
+            } else if constexpr (std::is_same_v<Period, std::exa>) {
+                return "Es";
+            } else if constexpr (std::is_same_v<Period, std::ratio<60>>) {
+                return "min";
+            } else if constexpr (std::is_same_v<Period, std::ratio<3600>>) {
+                return "h";
+            } else if constexpr (std::is_same_v<Period, std::ratio<86400>>) {
+                return "d";
+            } else {
+                return std::string_view(ratioSuffix.characters.data(), ratioSuffix.length);
+            }
+        }
+
+    private:
+        struct RatioSuffix {
+            std::array<char, 2 * (std::numeric_limits<std::intmax_t>::digits10 + 2) + 4> characters{};
+            std::size_t length = 0;
+        };
+
+        static constexpr RatioSuffix makeRatioSuffix() noexcept {
+            RatioSuffix suffix;
+            const auto append = [&suffix](std::intmax_t value) {
+                char digits[std::numeric_limits<std::intmax_t>::digits10 + 2]{};
+                std::size_t count = 0;
+                do {
+                    digits[count++] = static_cast<char>('0' + value % 10);
+                    value /= 10;
+                } while (value != 0);
+                while (count != 0) {
+                    suffix.characters[suffix.length++] = digits[--count];
+                }
+            };
+            suffix.characters[suffix.length++] = '[';
+            append(Period::num);
+            if (Period::den != 1) {
+                suffix.characters[suffix.length++] = '/';
+                append(Period::den);
+            }
+            suffix.characters[suffix.length++] = ']';
+            suffix.characters[suffix.length++] = 's';
+            return suffix;
+        }
+
+        static constexpr RatioSuffix ratioSuffix = makeRatioSuffix();
+    };
+
+    // a floating point duration converted once, like FloatingPointCharacters
+    template<std::floating_point Rep, typename Period>
+    struct FloatingPointDurationCharacters {
+        explicit FloatingPointDurationCharacters(const std::chrono::duration<Rep, Period>& value) noexcept :
+                count(value.count()) {
+        }
+
+        FloatingPointCharacters<Rep> count;
+    };
+
+    template<std::floating_point Rep, typename Period, CharTypes T>
+    struct Formatter<FloatingPointDurationCharacters<Rep, Period>, T> {
+        static std::size_t getSize(const FloatingPointDurationCharacters<Rep, Period>& value) noexcept {
+            return value.count.length + DurationSuffix<Period>::get().length();
+        }
+
+        static T* format(T* output, const FloatingPointDurationCharacters<Rep, Period>& value) noexcept {
+            output = Formatter<FloatingPointCharacters<Rep>, T>::format(output, value.count);
+            const std::string_view suffix = DurationSuffix<Period>::get();
+            return std::copy(suffix.begin(), suffix.end(), output);
+        }
+    };
+
+    template<typename Rep, typename Period, CharTypes T>
+    struct Formatter<std::chrono::duration<Rep, Period>, T> {
+        static std::size_t getSize(const std::chrono::duration<Rep, Period>& value) noexcept {
+            if constexpr (std::floating_point<Rep>) {
+                return FloatingPointDurationCharacters<Rep, Period>(value).count.length +
+                       DurationSuffix<Period>::get().length();
+            } else {
+                return Formatter<Rep, T>::getSize(value.count()) + DurationSuffix<Period>::get().length();
+            }
+        }
+
+        static T* format(T* output, const std::chrono::duration<Rep, Period>& value) noexcept {
+            if constexpr (std::floating_point<Rep>) {
+                return Formatter<FloatingPointDurationCharacters<Rep, Period>, T>::format(
+                        output, FloatingPointDurationCharacters<Rep, Period>(value));
+            } else {
+                output = Formatter<Rep, T>::format(output, value.count());
+                const std::string_view suffix = DurationSuffix<Period>::get();
+                return std::copy(suffix.begin(), suffix.end(), output);
+            }
+        }
+    };
+
+    // values whose characters are computed by a conversion that the renders run once instead of twice
+    template<typename V>
+    struct IsPreparedFormatted : std::bool_constant<std::floating_point<V>> {
+    };
+
+    template<std::floating_point Rep, typename Period>
+    struct IsPreparedFormatted<std::chrono::duration<Rep, Period>> : std::true_type {
+    };
+
+    // the renders convert floating point values and durations once up front instead of once for the size and once
+    // for the output, other values are passed through by reference
+    template<typename V>
+    decltype(auto) prepareFormatted(const V& value) noexcept {
+        if constexpr (std::floating_point<V>) {
+            return FloatingPointCharacters<V>(value);
+        } else if constexpr (IsPreparedFormatted<V>::value) {
+            return FloatingPointDurationCharacters<typename V::rep, typename V::period>(value);
+        } else {
+            return (value);
+        }
+    }
+
+    // system clock time points are written in UTC as "YYYY-MM-DD HH:MM:SS", like %Y of std::format the year has
+    // at least four digits, more after 9999, and a minus sign before year 0
+    template<typename Duration, CharTypes T>
+    struct Formatter<std::chrono::time_point<std::chrono::system_clock, Duration>, T> {
+        static std::size_t getSize(const std::chrono::time_point<std::chrono::system_clock, Duration>& value) noexcept {
+            const int year = getYear(std::chrono::floor<std::chrono::days>(value));
+            return (year < 0 ? 1 : 0) + getYearWidth(year) + 15;
+        }
+
+        static T* format(T* output, const std::chrono::time_point<std::chrono::system_clock, Duration>& value) noexcept {
+            const auto days = std::chrono::floor<std::chrono::days>(value);
+            const std::chrono::year_month_day date(days);
+            const std::chrono::hh_mm_ss time(std::chrono::floor<std::chrono::seconds>(value - days));
+            const int year = static_cast<int>(date.year());
+            if (year < 0) {
+                *output++ = T('-');
+            }
+            output = formatDigits(output, year < 0 ? -year : year, getYearWidth(year));
+            *output++ = T('-');
+            output = formatDigits(output, static_cast<unsigned>(date.month()), 2);
+            *output++ = T('-');
+            output = formatDigits(output, static_cast<unsigned>(date.day()), 2);
+            *output++ = T(' ');
+            output = formatDigits(output, time.hours().count(), 2);
+            *output++ = T(':');
+            output = formatDigits(output, time.minutes().count(), 2);
+            *output++ = T(':');
+            return formatDigits(output, time.seconds().count(), 2);
+        }
+
+    private:
+        static int getYear(const std::chrono::sys_days& days) noexcept {
+            return static_cast<int>(std::chrono::year_month_day(days).year());
+        }
+
+        static int getYearWidth(int year) noexcept {
+            int width = 4;
+            for (int rest = (year < 0 ? -year : year) / 10000; rest != 0; rest /= 10) {
+                ++width;
+            }
+            return width;
+        }
+
+        static T* formatDigits(T* output, long long value, int width) noexcept {
+            for (int position = width - 1; position >= 0; --position) {
+                output[position] = static_cast<T>(T('0') + value % 10);
+                value /= 10;
+            }
+            return output + width;
+        }
+    };
+
+    template<CharTypes T, typename V>
+    struct Argument {
+        std::basic_string_view<T> name;
+        const V& value;
+    };
+
+    template<CharTypes T, typename V>
+    constexpr Argument<T, V> argument(std::basic_string_view<T> name, const V& value) noexcept {
+        return Argument<T, V>{name, value};
+    }
+
+    template<CharTypes T, typename V>
+    constexpr Argument<T, V> argument(const T* name, const V& value) noexcept {
+        return Argument<T, V>{std::basic_string_view<T>(name), value};
+    }
+
+    template<CharTypes T, typename Allocator = std::allocator<T>>
+    class BasicStringTemplate;
+
+    template<CharTypes T, typename Allocator = std::allocator<T>>
+    class BasicRenderedBatch {
+    public:
+        using String = std::basic_string<T, std::char_traits<T>, Allocator>;
+        using Offsets = std::vector<std::size_t,
+                                    typename std::allocator_traits<Allocator>::template rebind_alloc<std::size_t>>;
+
+        explicit BasicRenderedBatch(const Allocator& allocator = Allocator()) noexcept;
+
+        std::size_t getSize() const noexcept;
+
+        std::basic_string_view<T> operator[](std::size_t index) const noexcept;
+
+        const String& getArena() const noexcept;
+
+        const Offsets& getOffsets() const noexcept;
+
+    private:
+        friend class BasicStringTemplate<T, Allocator>;
+
+        String arena;
+        Offsets offsets;
+    };
+
+    template<CharTypes T, typename Allocator>
+    BasicRenderedBatch<T, Allocator>::BasicRenderedBatch(const Allocator& allocator) noexcept :
+            arena(allocator), offsets(1, 0, allocator) {
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicRenderedBatch<T, Allocator>::getSize() const noexcept {
+        return this->offsets.size() - 1;
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::basic_string_view<T> BasicRenderedBatch<T, Allocator>::operator[](std::size_t index) const noexcept {
+        return std::basic_string_view<T>(this->arena).substr(this->offsets[index],
+                                                             this->offsets[index + 1] - this->offsets[index]);
+    }
+
+    template<CharTypes T, typename Allocator>
+    const typename BasicRenderedBatch<T, Allocator>::String&
+    BasicRenderedBatch<T, Allocator>::getArena() const noexcept {
+        return this->arena;
+    }
+
+    template<CharTypes T, typename Allocator>
+    const typename BasicRenderedBatch<T, Allocator>::Offsets&
+    BasicRenderedBatch<T, Allocator>::getOffsets() const noexcept {
+        return this->offsets;
+    }
+
+    template<CharTypes T, typename Allocator>
+    class BasicStringTemplate {
+    public:
+        template<typename U>
+        using RebindAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<U>;
+
+        using String = std::basic_string<T, std::char_traits<T>, Allocator>;
+        using Arguments = std::map<String, String, std::less<String>, RebindAllocator<std::pair<const String, String>>>;
+        using Column = std::vector<String, RebindAllocator<String>>;
+        using Columns = std::map<String, Column, std::less<String>, RebindAllocator<std::pair<const String, Column>>>;
+        using Fragments = std::vector<std::basic_string_view<T>, RebindAllocator<std::basic_string_view<T>>>;
+
+        // source is npos for the own pattern, otherwise the index of the composed template the literal is viewed in
+        struct Segment {
+            SegmentKinds kind;
+            std::size_t offset;
+            std::size_t length;
+            std::size_t slot;
+            std::size_t source = npos;
+        };
+
+        struct Placeholder {
+            String replaceable;
+            String name;
+        };
+
+        using Segments = std::vector<Segment, RebindAllocator<Segment>>;
+        using Placeholders = std::vector<Placeholder, RebindAllocator<Placeholder>>;
+        using Partials = std::map<String, std::shared_ptr<const BasicStringTemplate>, std::less<String>,
+                RebindAllocator<std::pair<const String, std::shared_ptr<const BasicStringTemplate>>>>;
+
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        explicit BasicStringTemplate(const String& pattern, const Allocator& allocator = Allocator()) noexcept;
+
+        BasicStringTemplate(const String& pattern,
+                            const String& openDelimiter,
+                            const String& closeDelimiter,
+                            const Allocator& allocator = Allocator()) noexcept;
+
+        // the placeholders named by a partial, by name or by full placeholder, are replaced with the partial's segments,
+        // its literals are viewed in the partial and not copied, the partial's placeholders become placeholders of this template
+        BasicStringTemplate(const String& pattern,
+                            const String& openDelimiter,
+                            const String& closeDelimiter,
+                            const Partials& partials,
+                            const Allocator& allocator = Allocator()) noexcept;
+
+        // joins the segments of the parts without parsing them again, each part keeps its own delimiters.
+        // the joined template has no pattern and delimiters of its own, its literals are viewed in the parts
+        explicit BasicStringTemplate(std::span<const std::shared_ptr<const BasicStringTemplate>> parts,
+                                     const Allocator& allocator = Allocator()) noexcept;
+
+        Allocator getAllocator() const noexcept;
+
+        const String& getPattern() const noexcept;
+
+        const String& getOpenDelimiter() const noexcept;
+
+        const String& getCloseDelimiter() const noexcept;
+
+        const Segments& getSegments() const noexcept;
+
+        const Placeholders& getPlaceholders() const noexcept;
+
+        std::size_t findPlaceholder(std::basic_string_view<T> replaceable) const noexcept;
+
+        std::basic_string_view<T> getSegmentView(const Segment& segment) const noexcept;
+
+        // offsets of the open delimiters without a close delimiter, they are kept as literal text.
+        // the offsets are in the text rendered without arguments, which is the pattern unless the template is composed
+        const std::vector<std::size_t, RebindAllocator<std::size_t>>& getUnterminatedPlaceholders() const noexcept;
+
+        std::size_t getRenderedSize(const Arguments& patternArguments) const noexcept;
+
+        String render(const Arguments& patternArguments) const noexcept;
+
+        void renderTo(String& output, const Arguments& patternArguments) const noexcept;
+
+        template<std::output_iterator<const T&> OutputIterator>
+        OutputIterator renderTo(OutputIterator output,
+                                const Arguments& patternArguments) const noexcept;
+
+        std::size_t renderTo(std::span<T> output,
+                             const Arguments& patternArguments) const noexcept;
+
+        void renderTo(std::basic_ostream<T>& output,
+                      const Arguments& patternArguments) const noexcept;
+
+        // the fragments view the template's pattern and the argument values, they stay valid
+        // as long as both the template and the arguments are alive and unmodified
+        Fragments renderFragments(const Arguments& patternArguments) const noexcept;
+
+        void renderFragmentsTo(Fragments& output, const Arguments& patternArguments) const noexcept;
+
+        template<Formattable<T>... Values>
+        std::size_t getRenderedSize(const Argument<T, Values>&... arguments) const noexcept;
+
+        template<Formattable<T>... Values>
+        String render(const Argument<T, Values>&... arguments) const noexcept;
+
+        template<Formattable<T>... Values>
+        void renderTo(String& output, const Argument<T, Values>&... arguments) const noexcept;
+
+        BasicRenderedBatch<T, Allocator> renderBatch(
+                std::span<const Arguments> rows,
+                BatchExecutionModes mode = BatchExecutionModes::SEQUENTIAL) const noexcept;
+
+        // the row count is the length of the columns the template references, which must all have the same length,
+        // a mismatch asserts and renders no rows
+        BasicRenderedBatch<T, Allocator> renderBatch(
+                const Columns& columns,
+                BatchExecutionModes mode = BatchExecutionModes::SEQUENTIAL) const noexcept;
+
+    private:
+        using Slots = std::map<std::basic_string_view<T>, std::size_t, std::less<std::basic_string_view<T>>,
+                RebindAllocator<std::pair<const std::basic_string_view<T>, std::size_t>>>;
+
+        void compile() noexcept;
+
+        void markUnterminatedPlaceholders(std::size_t first, std::size_t last) noexcept;
+
+        void includePartials(const Partials& partials) noexcept;
+
+        void appendTemplate(const std::shared_ptr<const BasicStringTemplate>& part, Slots& slots,
+                            std::size_t& position) noexcept;
+
+        void appendSegment(const Segment& segment, const Placeholders& segmentPlaceholders, std::size_t source,
+                           Slots& slots) noexcept;
+
+        std::size_t addSource(const std::shared_ptr<const BasicStringTemplate>& source) noexcept;
+
+        void indexPlaceholders(const Slots& slots) noexcept;
+
+        template<typename FragmentVisitor>
+        void visitFragments(const Arguments& patternArguments, FragmentVisitor&& visitor) const noexcept;
+
+        bool isPlaceholderNamed(std::size_t slot, std::basic_string_view<T> name) const noexcept;
+
+        template<typename SizeOfRow, typename WriteRow>
+        BasicRenderedBatch<T, Allocator> renderRows(std::size_t rowCount, SizeOfRow&& sizeOfRow, WriteRow&& writeRow,
+                                                    BatchExecutionModes mode) const noexcept;
+
+        static std::size_t getRowRangeCount(std::size_t rowCount, BatchExecutionModes mode) noexcept;
+
+        // a thread is only started for at least this many rows, fewer are rendered faster than a thread starts
+        static constexpr std::size_t minRowsPerThread = 1024;
+
+        template<typename ValueVisitor, typename... Values>
+        bool visitArgument(std::size_t slot, ValueVisitor&& visitor,
+                           const Argument<T, Values>&... arguments) const noexcept;
+
+        const String* findReplacement(std::size_t slot, const Arguments& patternArguments) const noexcept;
+
+        String pattern;
+        String openDelimiter, closeDelimiter;
+        Segments segments;
+        Placeholders placeholders;
+        std::vector<std::size_t, RebindAllocator<std::size_t>> slotsByReplaceable;
+        std::vector<std::size_t, RebindAllocator<std::size_t>> unterminatedPlaceholders;
+        std::vector<std::shared_ptr<const BasicStringTemplate>, RebindAllocator<std::shared_ptr<const BasicStringTemplate>>>
+                sources;
+    };
+
+    template<CharTypes T, typename Allocator>
+    BasicStringTemplate<T, Allocator>::BasicStringTemplate(const String& pattern,
+                                                           const String& openDelimiter,
+                                                           const String& closeDelimiter,
+                                                           const Allocator& allocator) noexcept :
+            pattern(pattern, allocator), openDelimiter(openDelimiter, allocator),
+            closeDelimiter(closeDelimiter, allocator), segments(allocator), placeholders(allocator),
+            slotsByReplaceable(allocator), unterminatedPlaceholders(allocator), sources(allocator) {
+        this->compile();
+    }
+
+    template<CharTypes T, typename Allocator>
+    BasicStringTemplate<T, Allocator>::BasicStringTemplate(const String& pattern,
+                                                           const String& openDelimiter,
+                                                           const String& closeDelimiter,
+                                                           const Partials& partials,
+                                                           const Allocator& allocator) noexcept :
+            BasicStringTemplate(pattern, openDelimiter, closeDelimiter, allocator) {
+        if (!partials.empty()) {
+            this->includePartials(partials);
+        }
+    }
+
+    template<CharTypes T, typename Allocator>
+    BasicStringTemplate<T, Allocator>::BasicStringTemplate(
+            std::span<const std::shared_ptr<const BasicStringTemplate>> parts,
+            const Allocator& allocator) noexcept :
+            pattern(allocator), openDelimiter(allocator), closeDelimiter(allocator), segments(allocator),
+            placeholders(allocator), slotsByReplaceable(allocator), unterminatedPlaceholders(allocator),
+            sources(allocator) {
+        Slots slots(allocator);
+        std::size_t position = 0;
+        for (const std::shared_ptr<const BasicStringTemplate>& part: parts) {
+            if (part) {
+                this->appendTemplate(part, slots, position);
+            }
+        }
+        this->indexPlaceholders(slots);
+    }
+
+    template<CharTypes T, typename Allocator>
+    Allocator BasicStringTemplate<T, Allocator>::getAllocator() const noexcept {
+        return this->pattern.get_allocator();
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringTemplate<T, Allocator>::compile() noexcept {
+        const std::basic_string_view<T> pattern(this->pattern);
+        const std::size_t openLength = this->openDelimiter.length();
+        const std::size_t closeLength = this->closeDelimiter.length();
+        if (pattern.empty()) {
+            return;
+        }
+        if (openLength == 0 || closeLength == 0) {
+            this->segments.push_back({SegmentKinds::LITERAL, 0, pattern.length(), npos});
+            return;
+        }
+
+        // with identical delimiters a stray delimiter cannot be told apart from a close delimiter, so a name that is
+        // empty or contains whitespace is literal text and its close delimiter is tried as the next open delimiter
+        const bool sameDelimiters = this->openDelimiter == this->closeDelimiter;
+        const auto isName = [](std::basic_string_view<T> name) {
+            return !name.empty() && std::ranges::none_of(name, [](T character) {
+                return character == static_cast<T>(' ') || character == static_cast<T>('\t') ||
+                       character == static_cast<T>('\n') || character == static_cast<T>('\r');
+            });
+        };
+
+        Slots slots(this->getAllocator());
+        std::size_t literalStart = 0;
+        std::size_t searchStart = 0;
+        std::size_t open;
+        while ((open = BasicDelimiterScanner<T>::find(pattern, this->openDelimiter, searchStart)) !=
+               std::basic_string_view<T>::npos) {
+            const std::size_t close = BasicDelimiterScanner<T>::find(pattern, this->closeDelimiter, open + openLength);
+            if (close == std::basic_string_view<T>::npos) {
+                this->markUnterminatedPlaceholders(open, pattern.length());
+                break;
+            }
+            if (sameDelimiters && !isName(pattern.substr(open + openLength, close - open - openLength))) {
+                searchStart = close;
+                continue;
+            }
+            // an earlier open delimiter without its own close delimiter stays literal text
+            const std::size_t innermostOpen = sameDelimiters ? std::basic_string_view<T>::npos :
+                                              pattern.rfind(this->openDelimiter, close - openLength);
+            if (innermostOpen != std::basic_string_view<T>::npos && innermostOpen > open) {
+                this->markUnterminatedPlaceholders(open, innermostOpen);
+                open = innermostOpen;
+            }
+            if (open > literalStart) {
+                this->segments.push_back({SegmentKinds::LITERAL, literalStart, open - literalStart, npos});
+            }
+            const std::size_t end = close + closeLength;
+            const std::basic_string_view<T> replaceable = pattern.substr(open, end - open);
+            const auto [slot, inserted] = slots.try_emplace(replaceable, this->placeholders.size());
+            if (inserted) {
+                this->placeholders.push_back({String(replaceable, this->getAllocator()),
+                                              String(pattern.substr(open + openLength, close - open - openLength),
+                                                     this->getAllocator())});
+            }
+            this->segments.push_back({SegmentKinds::PLACEHOLDER, open, end - open, slot->second});
+            literalStart = end;
+            searchStart = end;
+        }
+        if (literalStart < pattern.length()) {
+            this->segments.push_back({SegmentKinds::LITERAL, literalStart, pattern.length() - literalStart, npos});
+        }
+        this->indexPlaceholders(slots);
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringTemplate<T, Allocator>::indexPlaceholders(const Slots& slots) noexcept {
+        this->slotsByReplaceable.reserve(slots.size());
+        for (const auto& [replaceable, slot]: slots) {
+            this->slotsByReplaceable.push_back(slot);
+        }
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringTemplate<T, Allocator>::includePartials(const Partials& partials) noexcept {
+        const Segments ownSegments(std::move(this->segments));
+        const Placeholders ownPlaceholders(std::move(this->placeholders));
+        const std::vector<std::size_t, RebindAllocator<std::size_t>> ownUnterminated(std::move(this->unterminatedPlaceholders));
+        this->segments.clear();
+        this->placeholders.clear();
+        this->slotsByReplaceable.clear();
+        this->unterminatedPlaceholders.clear();
+
+        Slots slots(this->getAllocator());
+        std::size_t position = 0;
+        auto unterminated = ownUnterminated.begin();
+        for (const Segment& segment: ownSegments) {
+            if (segment.kind == SegmentKinds::PLACEHOLDER) {
+                auto partial = partials.find(ownPlaceholders[segment.slot].replaceable);
+                if (partial == partials.end()) {
+                    partial = partials.find(ownPlaceholders[segment.slot].name);
+                }
+                if (partial != partials.end() && partial->second) {
+                    this->appendTemplate(partial->second, slots, position);
+                    continue;
+                }
+            }
+            for (; unterminated != ownUnterminated.end() && *unterminated < segment.offset + segment.length; ++unterminated) {
+                this->unterminatedPlaceholders.push_back(*unterminated - segment.offset + position);
+            }
+            this->appendSegment(segment, ownPlaceholders, npos, slots);
+            position += segment.length;
+        }
+        this->indexPlaceholders(slots);
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringTemplate<T, Allocator>::appendTemplate(const std::shared_ptr<const BasicStringTemplate>& part,
+                                                           Slots& slots, std::size_t& position) noexcept {
+        for (const std::size_t unterminated: part->unterminatedPlaceholders) {
+            this->unterminatedPlaceholders.push_back(position + unterminated);
+        }
+        for (const Segment& segment: part->segments) {
+            const std::size_t source = this->addSource(segment.source == npos ? part : part->sources[segment.source]);
+            this->appendSegment(segment, part->placeholders, source, slots);
+            position += segment.length;
+        }
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringTemplate<T, Allocator>::appendSegment(const Segment& segment,
+                                                          const Placeholders& segmentPlaceholders,
+                                                          std::size_t source, Slots& slots) noexcept {
+        Segment appended = segment;
+        appended.source = source;
+        if (segment.kind == SegmentKinds::PLACEHOLDER) {
+            const Placeholder& placeholder = segmentPlaceholders[segment.slot];
+            const auto [slot, inserted] = slots.try_emplace(placeholder.replaceable, this->placeholders.size());
+            if (inserted) {
+                this->placeholders.push_back({String(placeholder.replaceable, this->getAllocator()),
+                                              String(placeholder.name, this->getAllocator())});
+            }
+            appended.slot = slot->second;
+        }
+        this->segments.push_back(appended);
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicStringTemplate<T, Allocator>::addSource(
+            const std::shared_ptr<const BasicStringTemplate>& source) noexcept {
+        const auto found = std::find(this->sources.begin(), this->sources.end(), source);
+        if (found != this->sources.end()) {
+            return static_cast<std::size_t>(found - this->sources.begin());
+        }
+        this->sources.push_back(source);
+        return this->sources.size() - 1;
+    }
+
+    template<CharTypes T, typename Allocator>
+    const typename BasicStringTemplate<T, Allocator>::String&
+    BasicStringTemplate<T, Allocator>::getPattern() const noexcept {
+        return this->pattern;
+    }
+
+    template<CharTypes T, typename Allocator>
+    const typename BasicStringTemplate<T, Allocator>::String&
+    BasicStringTemplate<T, Allocator>::getOpenDelimiter() const noexcept {
+        return this->openDelimiter;
+    }
+
+    template<CharTypes T, typename Allocator>
+    const typename BasicStringTemplate<T, Allocator>::String&
+    BasicStringTemplate<T, Allocator>::getCloseDelimiter() const noexcept {
+        return this->closeDelimiter;
+    }
+
+    template<CharTypes T, typename Allocator>
+    const typename BasicStringTemplate<T, Allocator>::Segments&
+    BasicStringTemplate<T, Allocator>::getSegments() const noexcept {
+        return this->segments;
+    }
+
+    template<CharTypes T, typename Allocator>
+    const typename BasicStringTemplate<T, Allocator>::Placeholders&
+    BasicStringTemplate<T, Allocator>::getPlaceholders() const noexcept {
+        return this->placeholders;
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicStringTemplate<T, Allocator>::findPlaceholder(std::basic_string_view<T> replaceable) const noexcept {
+        const auto slot = std::lower_bound(this->slotsByReplaceable.begin(), this->slotsByReplaceable.end(), replaceable,
+                                           [this](std::size_t slot, std::basic_string_view<T> replaceable) {
+                                               return std::basic_string_view<T>(this->placeholders[slot].replaceable) < replaceable;
+                                           });
+        if (slot != this->slotsByReplaceable.end() && this->placeholders[*slot].replaceable == replaceable) {
+            return *slot;
+        }
+        return npos;
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringTemplate<T, Allocator>::markUnterminatedPlaceholders(std::size_t first, std::size_t last) noexcept {
+        const std::size_t openLength = this->openDelimiter.length();
+        for (std::size_t open = first; open != std::basic_string_view<T>::npos && open + openLength <= last;
+             open = BasicDelimiterScanner<T>::find(this->pattern, this->openDelimiter, open + openLength)) {
+            this->unterminatedPlaceholders.push_back(open);
+        }
+    }
+
+    template<CharTypes T, typename Allocator>
+    const std::vector<std::size_t, typename BasicStringTemplate<T, Allocator>::template RebindAllocator<std::size_t>>&
+    BasicStringTemplate<T, Allocator>::getUnterminatedPlaceholders() const noexcept {
+        return this->unterminatedPlaceholders;
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::basic_string_view<T> BasicStringTemplate<T, Allocator>::getSegmentView(const Segment& segment) const noexcept {
+        const String& text = segment.source == npos ? this->pattern : this->sources[segment.source]->pattern;
+        return std::basic_string_view<T>(text).substr(segment.offset, segment.length);
+    }
+
+    template<CharTypes T, typename Allocator>
+    const typename BasicStringTemplate<T, Allocator>::String* BasicStringTemplate<T, Allocator>::findReplacement(
+            std::size_t slot,
+            const Arguments& patternArguments) const noexcept {
+        auto replacement = patternArguments.find(this->placeholders[slot].replaceable);
+        if (replacement == patternArguments.end()) {
+            replacement = patternArguments.find(this->placeholders[slot].name);
+        }
+        return replacement != patternArguments.end() ? &replacement->second : nullptr;
+    }
+
+    template<CharTypes T, typename Allocator>
+    template<typename FragmentVisitor>
+    void BasicStringTemplate<T, Allocator>::visitFragments(
+            const Arguments& patternArguments,
+            FragmentVisitor&& visitor) const noexcept {
+        for (const Segment& segment: this->segments) {
+            const String* replacement = segment.kind == SegmentKinds::PLACEHOLDER
+                                                      ? this->findReplacement(segment.slot, patternArguments)
+                                                      : nullptr;
+            if (replacement != nullptr) {
+                visitor(std::basic_string_view<T>(*replacement));
+            } else {
+                visitor(this->getSegmentView(segment));
+            }
+        }
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicStringTemplate<T, Allocator>::getRenderedSize(
+            const Arguments& patternArguments) const noexcept {
+        std::size_t size = 0;
+        this->visitFragments(patternArguments, [&size](std::basic_string_view<T> fragment) {
+            size += fragment.length();
+        });
+        return size;
+    }
+
+    template<CharTypes T, typename Allocator>
+    typename BasicStringTemplate<T, Allocator>::String BasicStringTemplate<T, Allocator>::render(
+            const Arguments& patternArguments) const noexcept {
+        String substitution(this->getAllocator());
+        this->renderTo(substitution, patternArguments);
+        return substitution;
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringTemplate<T, Allocator>::renderTo(
+            String& output,
+            const Arguments& patternArguments) const noexcept {
+        output.reserve(output.length() + this->getRenderedSize(patternArguments));
+        this->visitFragments(patternArguments, [&output](std::basic_string_view<T> fragment) {
+            output.append(fragment);
+        });
+    }
+
+    template<CharTypes T, typename Allocator>
+    template<std::output_iterator<const T&> OutputIterator>
+    OutputIterator BasicStringTemplate<T, Allocator>::renderTo(
+            OutputIterator output,
+            const Arguments& patternArguments) const noexcept {
+        this->visitFragments(patternArguments, [&output](std::basic_string_view<T> fragment) {
+            output = std::copy(fragment.begin(), fragment.end(), output);
+        });
+        return output;
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicStringTemplate<T, Allocator>::renderTo(
+            std::span<T> output,
+            const Arguments& patternArguments) const noexcept {
+        const std::size_t size = this->getRenderedSize(patternArguments);
+        if (size <= output.size()) {
+            this->renderTo(output.begin(), patternArguments);
+        }
+        return size;
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringTemplate<T, Allocator>::renderTo(
+            std::basic_ostream<T>& output,
+            const Arguments& patternArguments) const noexcept {
+        this->visitFragments(patternArguments, [&output](std::basic_string_view<T> fragment) {
+            output.write(fragment.data(), static_cast<std::streamsize>(fragment.length()));
+        });
+    }
+
+    template<CharTypes T, typename Allocator>
+    typename BasicStringTemplate<T, Allocator>::Fragments BasicStringTemplate<T, Allocator>::renderFragments(
+            const Arguments& patternArguments) const noexcept {
+        Fragments fragments(this->getAllocator());
+        this->renderFragmentsTo(fragments, patternArguments);
+        return fragments;
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringTemplate<T, Allocator>::renderFragmentsTo(
+            Fragments& output,
+            const Arguments& patternArguments) const noexcept {
+        output.reserve(output.size() + this->segments.size());
+        this->visitFragments(patternArguments, [&output](std::basic_string_view<T> fragment) {
+            if (!fragment.empty()) {
+                output.push_back(fragment);
+            }
+        });
+    }
+
+    template<CharTypes T, typename Allocator>
+    bool BasicStringTemplate<T, Allocator>::isPlaceholderNamed(std::size_t slot, std::basic_string_view<T> name) const noexcept {
+        return this->placeholders[slot].name == name || this->placeholders[slot].replaceable == name;
+    }
+
+    template<CharTypes T, typename Allocator>
+    template<typename ValueVisitor, typename... Values>
+    bool BasicStringTemplate<T, Allocator>::visitArgument(std::size_t slot, ValueVisitor&& visitor,
+                                                          const Argument<T, Values>&... arguments) const noexcept {
+        return ((this->isPlaceholderNamed(slot, arguments.name) && (visitor(arguments.value), true)) || ...);
+    }
+
+    template<CharTypes T, typename Allocator>
+    template<Formattable<T>... Values>
+    std::size_t BasicStringTemplate<T, Allocator>::getRenderedSize(const Argument<T, Values>&... arguments) const noexcept {
+        std::size_t size = 0;
+        for (const Segment& segment: this->segments) {
+            if (segment.kind != SegmentKinds::PLACEHOLDER ||
+                !this->visitArgument(segment.slot, [&size]<typename V>(const V& value) {
+                    size += Formatter<V, T>::getSize(value);
+                }, arguments...)) {
+                size += segment.length;
+            }
+        }
+        return size;
+    }
+
+    template<CharTypes T, typename Allocator>
+    template<Formattable<T>... Values>
+    typename BasicStringTemplate<T, Allocator>::String
+    BasicStringTemplate<T, Allocator>::render(const Argument<T, Values>&... arguments) const noexcept {
+        String substitution(this->getAllocator());
+        this->renderTo(substitution, arguments...);
+        return substitution;
+    }
+
+    template<CharTypes T, typename Allocator>
+    template<Formattable<T>... Values>
+    void BasicStringTemplate<T, Allocator>::renderTo(String& output,
+                                                     const Argument<T, Values>&... arguments) const noexcept {
+        if constexpr ((IsPreparedFormatted<Values>::value || ...)) {
+            this->renderTo(output, Argument<T, std::remove_cvref_t<decltype(prepareFormatted(arguments.value))>>{
+                    arguments.name, prepareFormatted(arguments.value)}...);
+            return;
+        }
+        const std::size_t start = output.length();
+        output.resize_and_overwrite(start + this->getRenderedSize(arguments...), [&](T* data, std::size_t) {
+            T* cursor = data + start;
+            for (const Segment& segment: this->segments) {
+                if (segment.kind != SegmentKinds::PLACEHOLDER ||
+                    !this->visitArgument(segment.slot, [&cursor]<typename V>(const V& value) {
+                        cursor = Formatter<V, T>::format(cursor, value);
+                    }, arguments...)) {
+                    const std::basic_string_view<T> literal = this->getSegmentView(segment);
+                    cursor = std::copy(literal.begin(), literal.end(), cursor);
+                }
+            }
+            return static_cast<std::size_t>(cursor - data);
+        });
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicStringTemplate<T, Allocator>::getRowRangeCount(std::size_t rowCount,
+                                                                    BatchExecutionModes mode) noexcept {
+        if (mode != BatchExecutionModes::PARALLEL) {
+            return 1;
+        }
+        return std::clamp<std::size_t>(rowCount / minRowsPerThread, 1,
+                                       std::max(1u, std::thread::hardware_concurrency()));
+    }
+
+    // the rows are split into one range per thread, every thread sizes its range, the calling thread adds up the
+    // offsets and allocates the arena, then the same threads write their ranges into it. A range whose thread
+    // cannot be started is rendered by the calling thread
+    template<CharTypes T, typename Allocator>
+    template<typename SizeOfRow, typename WriteRow>
+    BasicRenderedBatch<T, Allocator> BasicStringTemplate<T, Allocator>::renderRows(
+            std::size_t rowCount, SizeOfRow&& sizeOfRow, WriteRow&& writeRow, BatchExecutionModes mode) const noexcept {
+        BasicRenderedBatch<T, Allocator> batch(this->getAllocator());
+        batch.offsets.resize(rowCount + 1);
+        const std::size_t rangeCount = getRowRangeCount(rowCount, mode);
+        const std::size_t rowsPerRange = (rowCount + rangeCount - 1) / rangeCount;
+        const auto sizeRange = [&](std::size_t range) {
+            for (std::size_t row = range * rowsPerRange; row < std::min((range + 1) * rowsPerRange, rowCount); ++row) {
+                batch.offsets[row + 1] = sizeOfRow(row);
+            }
+        };
+        T* arena = nullptr;
+        const auto writeRange = [&](std::size_t range) {
+            for (std::size_t row = range * rowsPerRange; row < std::min((range + 1) * rowsPerRange, rowCount); ++row) {
+                writeRow(row, arena + batch.offsets[row]);
+            }
+        };
+        std::latch sized(static_cast<std::ptrdiff_t>(rangeCount - 1));
+        std::latch allocated(1);
+        std::latch written(static_cast<std::ptrdiff_t>(rangeCount - 1));
+        std::vector<std::jthread> threads;
+        std::size_t startedRanges = 1;
+        try {
+            threads.reserve(rangeCount - 1);
+            for (; startedRanges < rangeCount; ++startedRanges) {
+                threads.emplace_back([&](std::size_t range) {
+                    sizeRange(range);
+                    sized.count_down();
+                    allocated.wait();
+                    writeRange(range);
+                    written.count_down();
+                }, startedRanges);
+            }
+        } catch (const std::system_error&) {
+        }
+        for (std::size_t range = 0; range < rangeCount; ++range) {
+            if (range == 0 || range >= startedRanges) {
+                sizeRange(range);
+                if (range != 0) {
+                    sized.count_down();
+                }
+            }
+        }
+        sized.wait();
+        for (std::size_t row = 0; row < rowCount; ++row) {
+            batch.offsets[row + 1] += batch.offsets[row];
+        }
+        batch.arena.resize_and_overwrite(batch.offsets[rowCount], [&](T* data, std::size_t size) {
+            arena = data;
+            allocated.count_down();
+            for (std::size_t range = 0; range < rangeCount; ++range) {
+                if (range == 0 || range >= startedRanges) {
+                    writeRange(range);
+                    if (range != 0) {
+                        written.count_down();
+                    }
+                }
+            }
+            written.wait();
+            return size;
+        });
+        return batch;
+    }
+
+    template<CharTypes T, typename Allocator>
+    BasicRenderedBatch<T, Allocator> BasicStringTemplate<T, Allocator>::renderBatch(
+            std::span<const Arguments> rows,
+            BatchExecutionModes mode) const noexcept {
+        return this->renderRows(rows.size(),
+                                [&](std::size_t row) {
+                                    return this->getRenderedSize(rows[row]);
+                                },
+                                [&](std::size_t row, T* output) {
+                                    this->renderTo(output, rows[row]);
+                                },
+                                mode);
+    }
+
+    template<CharTypes T, typename Allocator>
+    BasicRenderedBatch<T, Allocator> BasicStringTemplate<T, Allocator>::renderBatch(
+            const Columns& columns,
+            BatchExecutionModes mode) const noexcept {
+        std::vector<const Column*, RebindAllocator<const Column*>> slotColumns(this->placeholders.size(), nullptr,
+                                                                               this->getAllocator());
+        std::size_t rowCount = 0;
+        bool referenced = false;
+        bool sameLength = true;
+        for (std::size_t slot = 0; slot < this->placeholders.size(); ++slot) {
+            auto column = columns.find(this->placeholders[slot].replaceable);
+            if (column == columns.end()) {
+                column = columns.find(this->placeholders[slot].name);
+            }
+            if (column != columns.end()) {
+                slotColumns[slot] = &column->second;
+                sameLength = sameLength && (!referenced || column->second.size() == rowCount);
+                rowCount = column->second.size();
+                referenced = true;
+            }
+        }
+        assert(sameLength && "the columns referenced by the template have different lengths");
+        if (!sameLength) {
+            rowCount = 0;
+        }
+        const auto visitRow = [&](std::size_t row, auto&& visitor) {
+            for (const Segment& segment: this->segments) {
+                if (segment.kind == SegmentKinds::PLACEHOLDER && slotColumns[segment.slot] != nullptr) {
+                    visitor(std::basic_string_view<T>((*slotColumns[segment.slot])[row]));
+                } else {
+                    visitor(this->getSegmentView(segment));
+                }
+            }
+        };
+        return this->renderRows(rowCount,
+                                [&](std::size_t row) {
+                                    std::size_t size = 0;
+                                    visitRow(row, [&size](std::basic_string_view<T> fragment) {
+                                        size += fragment.length();
+                                    });
+                                    return size;
+                                },
+                                [&](std::size_t row, T* output) {
+                                    visitRow(row, [&output](std::basic_string_view<T> fragment) {
+                                        output = std::copy(fragment.begin(), fragment.end(), output);
+                                    });
+                                },
+                                mode);
+    }
+
+    struct TemplateCacheStatistics {
+        std::uint64_t hits;
+        std::uint64_t misses;
+        std::uint64_t evictions;
+        std::size_t size;
+    };
+
+    template<CharTypes T>
+    class BasicStringTemplateCache {
+    public:
+        static constexpr std::size_t defaultCapacity = 4096;
+
+        explicit BasicStringTemplateCache(std::size_t capacity = defaultCapacity) noexcept;
+
+        static BasicStringTemplateCache<T>& getGlobal() noexcept;
+
+        std::shared_ptr<const BasicStringTemplate<T>> get(std::basic_string_view<T> pattern,
+                                                          std::basic_string_view<T> openDelimiter,
+                                                          std::basic_string_view<T> closeDelimiter) noexcept;
+
+        std::size_t getCapacity() const noexcept;
+
+        void setCapacity(std::size_t capacity) noexcept;
+
+        void clear() noexcept;
+
+        TemplateCacheStatistics getStatistics() const noexcept;
+
+    private:
+        struct KeyView {
+            std::basic_string_view<T> pattern, openDelimiter, closeDelimiter;
+        };
+
+        struct Key {
+            std::basic_string<T> pattern, openDelimiter, closeDelimiter;
+
+            operator KeyView() const noexcept {
+                return {this->pattern, this->openDelimiter, this->closeDelimiter};
+            }
+        };
+
+        struct KeyHash {
+            using is_transparent = void;
+
+            std::size_t operator()(const KeyView& key) const noexcept {
+                const std::hash<std::basic_string_view<T>> hash;
+                std::size_t seed = hash(key.pattern);
+                seed ^= hash(key.openDelimiter) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+                seed ^= hash(key.closeDelimiter) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+                return seed;
+            }
+        };
+
+        struct KeyEqual {
+            using is_transparent = void;
+
+            bool operator()(const KeyView& left, const KeyView& right) const noexcept {
+                return left.pattern == right.pattern && left.openDelimiter == right.openDelimiter &&
+                       left.closeDelimiter == right.closeDelimiter;
+            }
+        };
+
+        struct Entry {
+            std::shared_ptr<const BasicStringTemplate<T>> stringTemplate;
+            mutable std::atomic<bool> referenced{true};
+        };
+
+        void evict() noexcept;
+
+        mutable std::shared_mutex mutex;
+        std::unordered_map<Key, Entry, KeyHash, KeyEqual> entries;
+        // entries in insertion order, swept by a CLOCK hand that evicts the first entry
+        // which was not referenced since the hand last passed it
+        std::vector<const Key*> clock;
+        std::size_t clockHand = 0;
+        std::size_t capacity;
+        std::atomic<std::uint64_t> hits{0}, misses{0}, evictions{0};
+    };
+
+    template<CharTypes T>
+    BasicStringTemplateCache<T>::BasicStringTemplateCache(std::size_t capacity) noexcept : capacity(capacity) {
+    }
+
+    template<CharTypes T>
+    BasicStringTemplateCache<T>& BasicStringTemplateCache<T>::getGlobal() noexcept {
+        static BasicStringTemplateCache<T> global;
+        return global;
+    }
+
+    template<CharTypes T>
+    std::shared_ptr<const BasicStringTemplate<T>> BasicStringTemplateCache<T>::get(
+            std::basic_string_view<T> pattern,
+            std::basic_string_view<T> openDelimiter,
+            std::basic_string_view<T> closeDelimiter) noexcept {
+        const KeyView key{pattern, openDelimiter, closeDelimiter};
+        {
+            const std::shared_lock lock(this->mutex);
+            const auto entry = this->entries.find(key);
+            if (entry != this->entries.end()) {
+                entry->second.referenced.store(true, std::memory_order_relaxed);
+                this->hits.fetch_add(1, std::memory_order_relaxed);
+                return entry->second.stringTemplate;
+            }
+        }
+
+        this->misses.fetch_add(1, std::memory_order_relaxed);
+        auto stringTemplate = std::make_shared<const BasicStringTemplate<T>>(std::basic_string<T>(pattern),
+                                                                             std::basic_string<T>(openDelimiter),
+                                                                             std::basic_string<T>(closeDelimiter));
+        const std::unique_lock lock(this->mutex);
+        if (this->capacity == 0) {
+            return stringTemplate;
+        }
+        const auto entry = this->entries.find(key);
+        if (entry != this->entries.end()) {
+            return entry->second.stringTemplate;
+        }
+        if (this->entries.size() >= this->capacity) {
+            this->evict();
+        }
+        const auto [inserted, _] = this->entries.try_emplace(
+                Key{std::basic_string<T>(pattern), std::basic_string<T>(openDelimiter), std::basic_string<T>(closeDelimiter)});
+        inserted->second.stringTemplate = stringTemplate;
+        this->clock.push_back(&inserted->first);
+        return stringTemplate;
+    }
+
+    template<CharTypes T>
+    void BasicStringTemplateCache<T>::evict() noexcept {
+        while (true) {
+            if (this->clockHand >= this->clock.size()) {
+                this->clockHand = 0;
+            }
+            const Key* key = this->clock[this->clockHand];
+            const auto entry = this->entries.find(static_cast<KeyView>(*key));
+            if (entry->second.referenced.exchange(false, std::memory_order_relaxed)) {
+                ++this->clockHand;
+                continue;
+            }
+            this->entries.erase(entry);
+            this->clock[this->clockHand] = this->clock.back();
+            this->clock.pop_back();
+            this->evictions.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    template<CharTypes T>
+    std::size_t BasicStringTemplateCache<T>::getCapacity() const noexcept {
+        const std::shared_lock lock(this->mutex);
+        return this->capacity;
+    }
+
+    template<CharTypes T>
+    void BasicStringTemplateCache<T>::setCapacity(std::size_t capacity) noexcept {
+        const std::unique_lock lock(this->mutex);
+        this->capacity = capacity;
+        while (this->entries.size() > this->capacity) {
+            this->evict();
+        }
+    }
+
+    template<CharTypes T>
+    void BasicStringTemplateCache<T>::clear() noexcept {
+        const std::unique_lock lock(this->mutex);
+        this->clock.clear();
+        this->clockHand = 0;
+        this->entries.clear();
+    }
+
+    template<CharTypes T>
+    TemplateCacheStatistics BasicStringTemplateCache<T>::getStatistics() const noexcept {
+        const std::shared_lock lock(this->mutex);
+        return {this->hits.load(std::memory_order_relaxed), this->misses.load(std::memory_order_relaxed),
+                this->evictions.load(std::memory_order_relaxed), this->entries.size()};
+    }
+
+    enum class TemplateBundleErrors {
+        TRUNCATED = 1,
+        BAD_MAGIC,
+        UNSUPPORTED_VERSION,
+        CHARACTER_SIZE_MISMATCH,
+        UNSUPPORTED_BYTE_ORDER,
+        MISALIGNED,
+        CORRUPTED,
+        UNREADABLE_FILE,
+        UNWRITABLE_FILE
+    };
+
+    // every integer of a bundle is a little endian 64 bit word, except the version and the character size
+    // in the header which are 32 bit words, and every section begins 8 byte aligned:
+    //   header       : magic, version, character size, count of templates, segments, placeholders,
+    //                  unterminated placeholders and characters
+    //   templates    : name, text, open and close delimiter as character offset and length, then the first
+    //                  segment, placeholder and unterminated placeholder of the template and their counts
+    //   segments     : kind, offset and length in the text of the template, placeholder slot
+    //   placeholders : replaceable and name as character offset and length, the slot at this position in
+    //                  replaceable order
+    //   unterminated placeholders : offset in the text of the template
+    //   characters   : the strings of every table, little endian code units
+    // the templates are sorted by name, the text of a template is the text it renders without arguments
+    struct TemplateBundleFormat {
+        static constexpr std::array<char, 8> magic{'I', 'S', 'T', 'R', 'B', 'N', 'D', 'L'};
+        static constexpr std::uint32_t version = 1;
+        static constexpr std::size_t wordSize = sizeof(std::uint64_t);
+        static constexpr std::size_t headerSize = magic.size() + 2 * sizeof(std::uint32_t) + 5 * wordSize;
+        static constexpr std::size_t templateWords = 14;
+        static constexpr std::size_t segmentWords = 4;
+        static constexpr std::size_t placeholderWords = 5;
+
+        template<std::unsigned_integral U>
+        static U read(const std::byte* data) noexcept {
+            U value;
+            std::memcpy(&value, data, sizeof(U));
+            if constexpr (std::endian::native == std::endian::big) {
+                value = std::byteswap(value);
+            }
+            return value;
+        }
+
+        template<std::unsigned_integral U>
+        static void write(std::ostream& output, U value) noexcept {
+            if constexpr (std::endian::native == std::endian::big) {
+                value = std::byteswap(value);
+            }
+            output.write(reinterpret_cast<const char*>(&value), sizeof(U));
+        }
+
+        static bool isInRange(std::uint64_t offset, std::uint64_t length, std::uint64_t size) noexcept {
+            return offset <= size && length <= size - offset;
+        }
+    };
+
+    template<CharTypes T, typename Allocator = std::allocator<T>>
+    class BasicTemplateBundleWriter {
+    public:
+        using String = typename BasicStringTemplate<T, Allocator>::String;
+
+        explicit BasicTemplateBundleWriter(const Allocator& allocator = Allocator()) noexcept;
+
+        std::size_t getTemplateCount() const noexcept;
+
+        // a template put under an existing name replaces it
+        void putTemplate(const String& name, const BasicStringTemplate<T, Allocator>& compiledTemplate) noexcept;
+
+        // compiles every regular file below the directory, named by its path relative to the directory
+        // with / separators, and returns the number of templates put
+        std::expected<std::size_t, TemplateBundleErrors> putDirectory(const std::filesystem::path& directory,
+                                                                      const String& openDelimiter,
+                                                                      const String& closeDelimiter) noexcept;
+
+        void writeTo(std::ostream& output) const noexcept;
+
+        std::expected<void, TemplateBundleErrors> writeTo(const std::filesystem::path& path) const noexcept;
+
+    private:
+        template<typename U>
+        using RebindAllocator = typename BasicStringTemplate<T, Allocator>::template RebindAllocator<U>;
+
+        using Words = std::vector<std::uint64_t, RebindAllocator<std::uint64_t>>;
+
+        std::map<String, BasicStringTemplate<T, Allocator>, std::less<String>,
+                 RebindAllocator<std::pair<const String, BasicStringTemplate<T, Allocator>>>> templates;
+    };
+
+    template<CharTypes T, typename Allocator>
+    BasicTemplateBundleWriter<T, Allocator>::BasicTemplateBundleWriter(const Allocator& allocator) noexcept :
+            templates(allocator) {
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicTemplateBundleWriter<T, Allocator>::getTemplateCount() const noexcept {
+        return this->templates.size();
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicTemplateBundleWriter<T, Allocator>::putTemplate(
+            const String& name, const BasicStringTemplate<T, Allocator>& compiledTemplate) noexcept {
+        this->templates.insert_or_assign(name, compiledTemplate);
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::expected<std::size_t, TemplateBundleErrors> BasicTemplateBundleWriter<T, Allocator>::putDirectory(
+            const std::filesystem::path& directory,
+            const String& openDelimiter,
+            const String& closeDelimiter) noexcept {
+        const Allocator allocator(this->templates.get_allocator());
+        std::error_code error;
+        std::filesystem::recursive_directory_iterator file(directory, error);
+        std::size_t count = 0;
+        for (; !error && file != std::filesystem::recursive_directory_iterator(); file.increment(error)) {
+            if (!file->is_regular_file(error)) {
+                continue;
+            }
+            const std::uintmax_t size = file->file_size(error);
+            std::ifstream input(file->path(), std::ios::binary);
+            if (error || !input || size % sizeof(T) != 0) {
+                return std::unexpected(TemplateBundleErrors::UNREADABLE_FILE);
+            }
+            String pattern(static_cast<std::size_t>(size / sizeof(T)), T(), allocator);
+            if (!input.read(reinterpret_cast<char*>(pattern.data()), static_cast<std::streamsize>(size))) {
+                return std::unexpected(TemplateBundleErrors::UNREADABLE_FILE);
+            }
+            const std::filesystem::path relative = file->path().lexically_relative(directory);
+            const auto name = [&relative]() {
+                if constexpr (std::is_same_v<T, char>) {
+                    return relative.generic_string();
+                } else if constexpr (std::is_same_v<T, char8_t>) {
+                    return relative.generic_u8string();
+                } else if constexpr (std::is_same_v<T, char16_t>) {
+                    return relative.generic_u16string();
+                } else if constexpr (std::is_same_v<T, char32_t>) {
+                    return relative.generic_u32string();
+                } else {
+                    return relative.generic_wstring();
+                }
+            }();
+            this->putTemplate(String(std::basic_string_view<T>(name), allocator),
+                              BasicStringTemplate<T, Allocator>(pattern, openDelimiter, closeDelimiter, allocator));
+            ++count;
+        }
+        if (error) {
+            return std::unexpected(TemplateBundleErrors::UNREADABLE_FILE);
+        }
+        return count;
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicTemplateBundleWriter<T, Allocator>::writeTo(std::ostream& output) const noexcept {
+        const Allocator allocator(this->templates.get_allocator());
+        Words templateWords(allocator), segmentWords(allocator), placeholderWords(allocator), unterminatedWords(allocator);
+        String characters(allocator);
+        const auto putString = [&characters](Words& words, std::basic_string_view<T> text) {
+            words.push_back(characters.length());
+            words.push_back(text.length());
+            characters.append(text);
+        };
+
+        std::vector<std::size_t, RebindAllocator<std::size_t>> slotsByReplaceable(allocator);
+        for (const auto& [name, compiledTemplate]: this->templates) {
+            putString(templateWords, name);
+            const std::size_t textOffset = characters.length();
+            for (const auto& segment: compiledTemplate.getSegments()) {
+                segmentWords.push_back(static_cast<std::uint64_t>(segment.kind));
+                segmentWords.push_back(characters.length() - textOffset);
+                segmentWords.push_back(segment.length);
+                segmentWords.push_back(segment.kind == SegmentKinds::PLACEHOLDER ? segment.slot : 0);
+                characters.append(compiledTemplate.getSegmentView(segment));
+            }
+            templateWords.push_back(textOffset);
+            templateWords.push_back(characters.length() - textOffset);
+            putString(templateWords, compiledTemplate.getOpenDelimiter());
+            putString(templateWords, compiledTemplate.getCloseDelimiter());
+
+            const auto& placeholders = compiledTemplate.getPlaceholders();
+            slotsByReplaceable.resize(placeholders.size());
+            for (std::size_t slot = 0; slot < placeholders.size(); ++slot) {
+                slotsByReplaceable[slot] = slot;
+            }
+            std::sort(slotsByReplaceable.begin(), slotsByReplaceable.end(),
+                      [&placeholders](std::size_t first, std::size_t second) {
+                          return placeholders[first].replaceable < placeholders[second].replaceable;
+                      });
+            templateWords.push_back(segmentWords.size() / TemplateBundleFormat::segmentWords -
+                                    compiledTemplate.getSegments().size());
+            templateWords.push_back(compiledTemplate.getSegments().size());
+            templateWords.push_back(placeholderWords.size() / TemplateBundleFormat::placeholderWords);
+            templateWords.push_back(placeholders.size());
+            for (std::size_t slot = 0; slot < placeholders.size(); ++slot) {
+                putString(placeholderWords, placeholders[slot].replaceable);
+                putString(placeholderWords, placeholders[slot].name);
+                placeholderWords.push_back(slotsByReplaceable[slot]);
+            }
+            templateWords.push_back(unterminatedWords.size());
+            templateWords.push_back(compiledTemplate.getUnterminatedPlaceholders().size());
+            unterminatedWords.insert(unterminatedWords.end(), compiledTemplate.getUnterminatedPlaceholders().begin(),
+                                     compiledTemplate.getUnterminatedPlaceholders().end());
+        }
+
+        output.write(TemplateBundleFormat::magic.data(), TemplateBundleFormat::magic.size());
+        TemplateBundleFormat::write(output, TemplateBundleFormat::version);
+        TemplateBundleFormat::write(output, static_cast<std::uint32_t>(sizeof(T)));
+        for (const std::uint64_t count: {static_cast<std::uint64_t>(this->templates.size()),
+                                         static_cast<std::uint64_t>(segmentWords.size() / TemplateBundleFormat::segmentWords),
+                                         static_cast<std::uint64_t>(placeholderWords.size() / TemplateBundleFormat::placeholderWords),
+                                         static_cast<std::uint64_t>(unterminatedWords.size()),
+                                         static_cast<std::uint64_t>(characters.length())}) {
+            TemplateBundleFormat::write(output, count);
+        }
+        for (const Words* words: {&templateWords, &segmentWords, &placeholderWords, &unterminatedWords}) {
+            for (const std::uint64_t word: *words) {
+                TemplateBundleFormat::write(output, word);
+            }
+        }
+        if constexpr (sizeof(T) == 1 || std::endian::native == std::endian::little) {
+            output.write(reinterpret_cast<const char*>(characters.data()),
+                         static_cast<std::streamsize>(characters.length() * sizeof(T)));
+        } else {
+            using CodeUnit = std::conditional_t<sizeof(T) == 2, std::uint16_t, std::uint32_t>;
+            for (const T character: characters) {
+                TemplateBundleFormat::write(output, static_cast<CodeUnit>(character));
+            }
+        }
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::expected<void, TemplateBundleErrors> BasicTemplateBundleWriter<T, Allocator>::writeTo(
+            const std::filesystem::path& path) const noexcept {
+        std::ofstream output(path, std::ios::binary | std::ios::trunc);
+        if (output) {
+            this->writeTo(output);
+            output.flush();
+        }
+        if (!output) {
+            return std::unexpected(TemplateBundleErrors::UNWRITABLE_FILE);
+        }
+        return {};
+    }
+
+    template<CharTypes T, typename Allocator = std::allocator<T>>
+    class BasicTemplateBundle;
+
+    // a compiled template read in place from a bundle, it stays valid as long as the bundle's data is mapped
+    template<CharTypes T, typename Allocator = std::allocator<T>>
+    class BasicTemplateView {
+    public:
+        using String = typename BasicStringTemplate<T, Allocator>::String;
+        using Arguments = typename BasicStringTemplate<T, Allocator>::Arguments;
+        using Segment = typename BasicStringTemplate<T, Allocator>::Segment;
+
+        struct Placeholder {
+            std::basic_string_view<T> replaceable;
+            std::basic_string_view<T> name;
+        };
+
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        std::basic_string_view<T> getName() const noexcept;
+
+        // the text rendered without arguments, the pattern unless the template was composed
+        std::basic_string_view<T> getPattern() const noexcept;
+
+        std::basic_string_view<T> getOpenDelimiter() const noexcept;
+
+        std::basic_string_view<T> getCloseDelimiter() const noexcept;
+
+        std::size_t getSegmentCount() const noexcept;
+
+        Segment getSegment(std::size_t index) const noexcept;
+
+        std::basic_string_view<T> getSegmentView(const Segment& segment) const noexcept;
+
+        std::size_t getPlaceholderCount() const noexcept;
+
+        Placeholder getPlaceholder(std::size_t slot) const noexcept;
+
+        std::size_t findPlaceholder(std::basic_string_view<T> replaceable) const noexcept;
+
+        std::size_t getUnterminatedPlaceholderCount() const noexcept;
+
+        std::size_t getUnterminatedPlaceholder(std::size_t index) const noexcept;
+
+        std::size_t getRenderedSize(const Arguments& patternArguments) const noexcept;
+
+        String render(const Arguments& patternArguments) const noexcept;
+
+        void renderTo(String& output, const Arguments& patternArguments) const noexcept;
+
+        template<std::output_iterator<const T&> OutputIterator>
+        OutputIterator renderTo(OutputIterator output, const Arguments& patternArguments) const noexcept;
+
+    private:
+        friend class BasicTemplateBundle<T, Allocator>;
+
+        BasicTemplateView(const std::byte* record, const BasicTemplateBundle<T, Allocator>& bundle) noexcept;
+
+        std::size_t getWord(std::size_t index) const noexcept;
+
+        template<typename FragmentVisitor>
+        void visitFragments(const Arguments& patternArguments, FragmentVisitor&& visitor) const noexcept;
+
+        static constexpr std::size_t maxArgumentCheckpoints = 32;
+
+        const std::byte* record;
+        const std::byte* segments;
+        const std::byte* placeholders;
+        const std::byte* unterminatedPlaceholders;
+        const T* characters;
+    };
+
+    template<CharTypes T, typename Allocator>
+    class BasicTemplateBundle {
+    public:
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        // checks the header and the bounds of every table once, the templates are then read in place without
+        // parsing or allocating. The data must stay mapped and unmodified while the bundle and its views are used
+        static std::expected<BasicTemplateBundle<T, Allocator>, TemplateBundleErrors> load(
+                std::span<const std::byte> data) noexcept;
+
+        std::size_t getTemplateCount() const noexcept;
+
+        BasicTemplateView<T, Allocator> getTemplate(std::size_t index) const noexcept;
+
+        std::size_t findTemplate(std::basic_string_view<T> name) const noexcept;
+
+    private:
+        friend class BasicTemplateView<T, Allocator>;
+
+        BasicTemplateBundle() noexcept = default;
+
+        bool isConsistent() const noexcept;
+
+        std::size_t templateCount = 0, segmentCount = 0, placeholderCount = 0, unterminatedCount = 0,
+                characterCount = 0;
+        const std::byte* templates = nullptr;
+        const std::byte* segments = nullptr;
+        const std::byte* placeholders = nullptr;
+        const std::byte* unterminatedPlaceholders = nullptr;
+        const T* characters = nullptr;
+    };
+
+    template<CharTypes T, typename Allocator>
+    BasicTemplateView<T, Allocator>::BasicTemplateView(const std::byte* record,
+                                                       const BasicTemplateBundle<T, Allocator>& bundle) noexcept :
+            record(record), segments(bundle.segments), placeholders(bundle.placeholders),
+            unterminatedPlaceholders(bundle.unterminatedPlaceholders), characters(bundle.characters) {
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicTemplateView<T, Allocator>::getWord(std::size_t index) const noexcept {
+        return static_cast<std::size_t>(
+                TemplateBundleFormat::read<std::uint64_t>(this->record + index * TemplateBundleFormat::wordSize));
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::basic_string_view<T> BasicTemplateView<T, Allocator>::getName() const noexcept {
+        return std::basic_string_view<T>(this->characters + this->getWord(0), this->getWord(1));
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::basic_string_view<T> BasicTemplateView<T, Allocator>::getPattern() const noexcept {
+        return std::basic_string_view<T>(this->characters + this->getWord(2), this->getWord(3));
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::basic_string_view<T> BasicTemplateView<T, Allocator>::getOpenDelimiter() const noexcept {
+        return std::basic_string_view<T>(this->characters + this->getWord(4), this->getWord(5));
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::basic_string_view<T> BasicTemplateView<T, Allocator>::getCloseDelimiter() const noexcept {
+        return std::basic_string_view<T>(this->characters + this->getWord(6), this->getWord(7));
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicTemplateView<T, Allocator>::getSegmentCount() const noexcept {
+        return this->getWord(9);
+    }
+
+    template<CharTypes T, typename Allocator>
+    typename BasicTemplateView<T, Allocator>::Segment
+    BasicTemplateView<T, Allocator>::getSegment(std::size_t index) const noexcept {
+        const std::byte* segment = this->segments + (this->getWord(8) + index) * TemplateBundleFormat::segmentWords *
+                                                    TemplateBundleFormat::wordSize;
+        const auto word = [segment](std::size_t index) {
+            return static_cast<std::size_t>(
+                    TemplateBundleFormat::read<std::uint64_t>(segment + index * TemplateBundleFormat::wordSize));
+        };
+        return {static_cast<SegmentKinds>(word(0)), word(1), word(2), word(3)};
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::basic_string_view<T> BasicTemplateView<T, Allocator>::getSegmentView(const Segment& segment) const noexcept {
+        return this->getPattern().substr(segment.offset, segment.length);
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicTemplateView<T, Allocator>::getPlaceholderCount() const noexcept {
+        return this->getWord(11);
+    }
+
+    template<CharTypes T, typename Allocator>
+    typename BasicTemplateView<T, Allocator>::Placeholder
+    BasicTemplateView<T, Allocator>::getPlaceholder(std::size_t slot) const noexcept {
+        const std::byte* placeholder = this->placeholders + (this->getWord(10) + slot) *
+                                                            TemplateBundleFormat::placeholderWords *
+                                                            TemplateBundleFormat::wordSize;
+        const auto word = [placeholder](std::size_t index) {
+            return static_cast<std::size_t>(
+                    TemplateBundleFormat::read<std::uint64_t>(placeholder + index * TemplateBundleFormat::wordSize));
+        };
+        return {std::basic_string_view<T>(this->characters + word(0), word(1)),
+                std::basic_string_view<T>(this->characters + word(2), word(3))};
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicTemplateView<T, Allocator>::findPlaceholder(std::basic_string_view<T> replaceable) const noexcept {
+        const auto slotAt = [this](std::size_t index) {
+            return static_cast<std::size_t>(TemplateBundleFormat::read<std::uint64_t>(
+                    this->placeholders + ((this->getWord(10) + index) * TemplateBundleFormat::placeholderWords + 4) *
+                                         TemplateBundleFormat::wordSize));
+        };
+        std::size_t first = 0;
+        std::size_t count = this->getPlaceholderCount();
+        while (count > 0) {
+            const std::size_t half = count / 2;
+            if (this->getPlaceholder(slotAt(first + half)).replaceable < replaceable) {
+                first += half + 1;
+                count -= half + 1;
+            } else {
+                count = half;
+            }
+        }
+        if (first < this->getPlaceholderCount() && this->getPlaceholder(slotAt(first)).replaceable == replaceable) {
+            return slotAt(first);
+        }
+        return npos;
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicTemplateView<T, Allocator>::getUnterminatedPlaceholderCount() const noexcept {
+        return this->getWord(13);
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicTemplateView<T, Allocator>::getUnterminatedPlaceholder(std::size_t index) const noexcept {
+        return static_cast<std::size_t>(TemplateBundleFormat::read<std::uint64_t>(
+                this->unterminatedPlaceholders + (this->getWord(12) + index) * TemplateBundleFormat::wordSize));
+    }
+
+    // the argument map finds only a key copied from the placeholder, so every stride-th argument is viewed in a table
+    // on the stack instead. A lookup binary searches the table and walks at most one stride of the map, up to
+    // maxArgumentCheckpoints arguments that is a plain binary search, and nothing is allocated per render
+    template<CharTypes T, typename Allocator>
+    template<typename FragmentVisitor>
+    void BasicTemplateView<T, Allocator>::visitFragments(const Arguments& patternArguments,
+                                                         FragmentVisitor&& visitor) const noexcept {
+        struct Checkpoint {
+            std::basic_string_view<T> replaceable;
+            std::basic_string_view<T> replacement;
+            typename Arguments::const_iterator argument;
+        };
+        std::array<Checkpoint, maxArgumentCheckpoints> checkpoints;
+        const std::size_t stride = std::max<std::size_t>(
+                1, (patternArguments.size() + maxArgumentCheckpoints - 1) / maxArgumentCheckpoints);
+        std::size_t checkpointCount = 0;
+        std::size_t position = 0;
+        for (auto argument = patternArguments.begin(); argument != patternArguments.end(); ++argument, ++position) {
+            if (position % stride == 0) {
+                checkpoints[checkpointCount++] = {argument->first, argument->second, argument};
+            }
+        }
+        const std::basic_string_view<T> lastReplaceable = patternArguments.empty()
+                                                          ? std::basic_string_view<T>()
+                                                          : std::basic_string_view<T>(patternArguments.rbegin()->first);
+        const auto find = [&](std::basic_string_view<T> key) -> std::optional<std::basic_string_view<T>> {
+            if (checkpointCount == 0 || lastReplaceable < key) {
+                return std::nullopt;
+            }
+            const auto checkpoint = std::ranges::upper_bound(checkpoints.begin(), checkpoints.begin() + checkpointCount,
+                                                             key, {}, &Checkpoint::replaceable);
+            if (checkpoint == checkpoints.begin()) {
+                return std::nullopt;
+            }
+            const Checkpoint& previous = *std::prev(checkpoint);
+            if (previous.replaceable == key) {
+                return previous.replacement;
+            }
+            auto argument = std::next(previous.argument);
+            for (std::size_t step = 1; step < stride && argument != patternArguments.end(); ++step, ++argument) {
+                const std::basic_string_view<T> replaceable(argument->first);
+                if (replaceable == key) {
+                    return argument->second;
+                }
+                if (key < replaceable) {
+                    break;
+                }
+            }
+            return std::nullopt;
+        };
+        for (std::size_t index = 0; index < this->getSegmentCount(); ++index) {
+            const Segment segment = this->getSegment(index);
+            std::optional<std::basic_string_view<T>> replacement;
+            if (segment.kind == SegmentKinds::PLACEHOLDER) {
+                const Placeholder placeholder = this->getPlaceholder(segment.slot);
+                replacement = find(placeholder.replaceable);
+                if (!replacement) {
+                    replacement = find(placeholder.name);
+                }
+            }
+            if (replacement) {
+                visitor(*replacement);
+            } else {
+                visitor(this->getSegmentView(segment));
+            }
+        }
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicTemplateView<T, Allocator>::getRenderedSize(const Arguments& patternArguments) const noexcept {
+        std::size_t size = 0;
+        this->visitFragments(patternArguments, [&size](std::basic_string_view<T> fragment) {
+            size += fragment.length();
+        });
+        return size;
+    }
+
+    template<CharTypes T, typename Allocator>
+    typename BasicTemplateView<T, Allocator>::String
+    BasicTemplateView<T, Allocator>::render(const Arguments& patternArguments) const noexcept {
+        String substitution{Allocator(patternArguments.get_allocator())};
+        this->renderTo(substitution, patternArguments);
+        return substitution;
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicTemplateView<T, Allocator>::renderTo(String& output, const Arguments& patternArguments) const noexcept {
+        output.reserve(output.length() + this->getRenderedSize(patternArguments));
+        this->visitFragments(patternArguments, [&output](std::basic_string_view<T> fragment) {
+            output.append(fragment);
+        });
+    }
+
+    template<CharTypes T, typename Allocator>
+    template<std::output_iterator<const T&> OutputIterator>
+    OutputIterator BasicTemplateView<T, Allocator>::renderTo(OutputIterator output,
+                                                             const Arguments& patternArguments) const noexcept {
+        this->visitFragments(patternArguments, [&output](std::basic_string_view<T> fragment) {
+            output = std::copy(fragment.begin(), fragment.end(), output);
+        });
+        return output;
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::expected<BasicTemplateBundle<T, Allocator>, TemplateBundleErrors> BasicTemplateBundle<T, Allocator>::load(
+            std::span<const std::byte> data) noexcept {
+        using Format = TemplateBundleFormat;
+        if (data.size() < Format::headerSize) {
+            return std::unexpected(TemplateBundleErrors::TRUNCATED);
+        }
+        if (std::memcmp(data.data(), Format::magic.data(), Format::magic.size()) != 0) {
+            return std::unexpected(TemplateBundleErrors::BAD_MAGIC);
+        }
+        if (Format::read<std::uint32_t>(data.data() + Format::magic.size()) != Format::version) {
+            return std::unexpected(TemplateBundleErrors::UNSUPPORTED_VERSION);
+        }
+        if (Format::read<std::uint32_t>(data.data() + Format::magic.size() + sizeof(std::uint32_t)) != sizeof(T)) {
+            return std::unexpected(TemplateBundleErrors::CHARACTER_SIZE_MISMATCH);
+        }
+        if (sizeof(T) > 1 && std::endian::native != std::endian::little) {
+            return std::unexpected(TemplateBundleErrors::UNSUPPORTED_BYTE_ORDER);
+        }
+
+        std::array<std::uint64_t, 5> counts{};
+        for (std::size_t index = 0; index < counts.size(); ++index) {
+            counts[index] = Format::read<std::uint64_t>(
+                    data.data() + Format::magic.size() + 2 * sizeof(std::uint32_t) + index * Format::wordSize);
+            if (counts[index] > data.size()) {
+                return std::unexpected(TemplateBundleErrors::TRUNCATED);
+            }
+        }
+        BasicTemplateBundle<T, Allocator> bundle;
+        bundle.templateCount = static_cast<std::size_t>(counts[0]);
+        bundle.segmentCount = static_cast<std::size_t>(counts[1]);
+        bundle.placeholderCount = static_cast<std::size_t>(counts[2]);
+        bundle.unterminatedCount = static_cast<std::size_t>(counts[3]);
+        bundle.characterCount = static_cast<std::size_t>(counts[4]);
+        const std::size_t tablesSize = (bundle.templateCount * Format::templateWords +
+                                        bundle.segmentCount * Format::segmentWords +
+                                        bundle.placeholderCount * Format::placeholderWords +
+                                        bundle.unterminatedCount) * Format::wordSize;
+        if (data.size() - Format::headerSize < tablesSize ||
+            (data.size() - Format::headerSize - tablesSize) / sizeof(T) < bundle.characterCount) {
+            return std::unexpected(TemplateBundleErrors::TRUNCATED);
+        }
+        bundle.templates = data.data() + Format::headerSize;
+        bundle.segments = bundle.templates + bundle.templateCount * Format::templateWords * Format::wordSize;
+        bundle.placeholders = bundle.segments + bundle.segmentCount * Format::segmentWords * Format::wordSize;
+        bundle.unterminatedPlaceholders = bundle.placeholders +
+                                          bundle.placeholderCount * Format::placeholderWords * Format::wordSize;
+        const std::byte* characters = bundle.unterminatedPlaceholders + bundle.unterminatedCount * Format::wordSize;
+        if (reinterpret_cast<std::uintptr_t>(characters) % alignof(T) != 0) {
+            return std::unexpected(TemplateBundleErrors::MISALIGNED);
+        }
+        bundle.characters = reinterpret_cast<const T*>(characters);
+        if (!bundle.isConsistent()) {
+            return std::unexpected(TemplateBundleErrors::CORRUPTED);
+        }
+        return bundle;
+    }
+
+    // every offset and count is checked against its table once, so the views read the tables unchecked
+    template<CharTypes T, typename Allocator>
+    bool BasicTemplateBundle<T, Allocator>::isConsistent() const noexcept {
+        using Format = TemplateBundleFormat;
+        for (std::size_t index = 0; index < this->templateCount; ++index) {
+            const BasicTemplateView<T, Allocator> view = this->getTemplate(index);
+            for (std::size_t word = 0; word < 8; word += 2) {
+                if (!Format::isInRange(view.getWord(word), view.getWord(word + 1), this->characterCount)) {
+                    return false;
+                }
+            }
+            if (!Format::isInRange(view.getWord(8), view.getWord(9), this->segmentCount) ||
+                !Format::isInRange(view.getWord(10), view.getWord(11), this->placeholderCount) ||
+                !Format::isInRange(view.getWord(12), view.getWord(13), this->unterminatedCount)) {
+                return false;
+            }
+            for (std::size_t segmentIndex = 0; segmentIndex < view.getSegmentCount(); ++segmentIndex) {
+                const std::byte* segment = this->segments + (view.getWord(8) + segmentIndex) * Format::segmentWords *
+                                                            Format::wordSize;
+                const std::uint64_t kind = Format::read<std::uint64_t>(segment);
+                if (kind > static_cast<std::uint64_t>(SegmentKinds::PLACEHOLDER) ||
+                    !Format::isInRange(Format::read<std::uint64_t>(segment + Format::wordSize),
+                                       Format::read<std::uint64_t>(segment + 2 * Format::wordSize), view.getWord(3)) ||
+                    (kind == static_cast<std::uint64_t>(SegmentKinds::PLACEHOLDER) &&
+                     Format::read<std::uint64_t>(segment + 3 * Format::wordSize) >= view.getWord(11))) {
+                    return false;
+                }
+            }
+            for (std::size_t slot = 0; slot < view.getPlaceholderCount(); ++slot) {
+                const std::byte* placeholder = this->placeholders + (view.getWord(10) + slot) *
+                                                                    Format::placeholderWords * Format::wordSize;
+                if (!Format::isInRange(Format::read<std::uint64_t>(placeholder),
+                                       Format::read<std::uint64_t>(placeholder + Format::wordSize),
+                                       this->characterCount) ||
+                    !Format::isInRange(Format::read<std::uint64_t>(placeholder + 2 * Format::wordSize),
+                                       Format::read<std::uint64_t>(placeholder + 3 * Format::wordSize),
+                                       this->characterCount) ||
+                    Format::read<std::uint64_t>(placeholder + 4 * Format::wordSize) >= view.getWord(11)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicTemplateBundle<T, Allocator>::getTemplateCount() const noexcept {
+        return this->templateCount;
+    }
+
+    template<CharTypes T, typename Allocator>
+    BasicTemplateView<T, Allocator> BasicTemplateBundle<T, Allocator>::getTemplate(std::size_t index) const noexcept {
+        return BasicTemplateView<T, Allocator>(
+                this->templates + index * TemplateBundleFormat::templateWords * TemplateBundleFormat::wordSize, *this);
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicTemplateBundle<T, Allocator>::findTemplate(std::basic_string_view<T> name) const noexcept {
+        std::size_t first = 0;
+        std::size_t count = this->templateCount;
+        while (count > 0) {
+            const std::size_t half = count / 2;
+            if (this->getTemplate(first + half).getName() < name) {
+                first += half + 1;
+                count -= half + 1;
+            } else {
+                count = half;
+            }
+        }
+        return first < this->templateCount && this->getTemplate(first).getName() == name ? first : npos;
+    }
+
+    template<CharTypes T, std::size_t N>
+    struct FixedString {
+        T data[N]{};
+
+        constexpr FixedString(const T (&string)[N]) noexcept {
+            std::copy_n(string, N, this->data);
+        }
+
+        constexpr std::basic_string_view<T> getView() const noexcept {
+            return std::basic_string_view<T>(this->data, N - 1);
+        }
+    };
+
+    template<FixedString Name, typename V>
+    struct FixedArgument {
+        const V& value;
+
+        static constexpr std::basic_string_view<std::remove_cvref_t<decltype(Name.data[0])>> getName() noexcept {
+            return Name.getView();
+        }
+    };
+
+    template<FixedString Name, typename V>
+    constexpr FixedArgument<Name, V> fixedArgument(const V& value) noexcept {
+        return FixedArgument<Name, V>{value};
+    }
+
+    template<FixedString Pattern, FixedString OpenDelimiter, FixedString CloseDelimiter>
+    class BasicFixedTemplate {
+    public:
+        using CharType = std::remove_cvref_t<decltype(Pattern.data[0])>;
+
+        static_assert(std::is_same_v<CharType, std::remove_cvref_t<decltype(OpenDelimiter.data[0])>> &&
+                      std::is_same_v<CharType, std::remove_cvref_t<decltype(CloseDelimiter.data[0])>>,
+                      "the pattern and its delimiters must use the same character type");
+        static_assert(!OpenDelimiter.getView().empty() && !CloseDelimiter.getView().empty(),
+                      "a fixed template cannot use empty delimiters");
+
+        static consteval std::basic_string_view<CharType> getPattern() noexcept;
+
+        static consteval std::size_t getPlaceholderCount() noexcept;
+
+        static consteval std::size_t getLiteralLength() noexcept;
+
+        template<typename... Arguments>
+        static std::basic_string<CharType> render(const Arguments&... arguments) noexcept;
+
+    private:
+        struct Layout {
+            std::size_t segmentCount = 0;
+            std::size_t placeholderCount = 0;
+            std::size_t literalLength = 0;
+            bool terminated = true;
+            bool named = true;
+        };
+
+        struct Segment {
+            SegmentKinds kind;
+            std::size_t offset;
+            std::size_t length;
+            std::size_t slot;
+        };
+
+        template<typename LiteralVisitor, typename PlaceholderVisitor>
+        static consteval Layout parse(LiteralVisitor&& onLiteral, PlaceholderVisitor&& onPlaceholder) noexcept;
+
+        static consteval Layout measure() noexcept;
+
+        static constexpr Layout layout = measure();
+
+        static_assert(layout.terminated, "the pattern contains an open delimiter without a matching close delimiter");
+        static_assert(layout.named, "the pattern contains a placeholder without a name");
+
+        static consteval std::array<Segment, layout.segmentCount> buildSegments() noexcept;
+
+        static consteval std::array<std::basic_string_view<CharType>, layout.placeholderCount> buildNames() noexcept;
+
+        template<typename... Arguments>
+        static consteval std::array<std::size_t, layout.placeholderCount> bindArguments() noexcept;
+
+        template<typename... Arguments>
+        static consteval bool isEveryArgumentUsed() noexcept;
+
+        template<typename ValueVisitor, typename... Values>
+        static void visitValueAt(std::size_t index, ValueVisitor&& visitor, const Values&... values) noexcept;
+
+        template<typename... Values>
+        static std::basic_string<CharType> renderValues(const std::array<std::size_t, layout.placeholderCount>& argumentIndexes,
+                                                        const Values&... values) noexcept;
+
+        static constexpr std::array<Segment, layout.segmentCount> segments = buildSegments();
+        static constexpr std::array<std::basic_string_view<CharType>, layout.placeholderCount> names = buildNames();
+    };
+
+    template<FixedString Pattern, FixedString OpenDelimiter, FixedString CloseDelimiter>
+    template<typename LiteralVisitor, typename PlaceholderVisitor>
+    consteval typename BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::Layout
+    BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::parse(LiteralVisitor&& onLiteral,
+                                                                      PlaceholderVisitor&& onPlaceholder) noexcept {
+        constexpr std::basic_string_view<CharType> pattern = Pattern.getView();
+        constexpr std::basic_string_view<CharType> openDelimiter = OpenDelimiter.getView();
+        constexpr std::basic_string_view<CharType> closeDelimiter = CloseDelimiter.getView();
+        Layout result;
+        std::size_t literalStart = 0;
+        std::size_t open;
+        while ((open = pattern.find(openDelimiter, literalStart)) != std::basic_string_view<CharType>::npos) {
+            const std::size_t nameStart = open + openDelimiter.length();
+            const std::size_t close = pattern.find(closeDelimiter, nameStart);
+            if (close == std::basic_string_view<CharType>::npos ||
+                pattern.substr(nameStart, close - nameStart).find(openDelimiter) != std::basic_string_view<CharType>::npos) {
+                result.terminated = false;
+                return result;
+            }
+            if (close == nameStart) {
+                result.named = false;
+                return result;
+            }
+            if (open > literalStart) {
+                onLiteral(literalStart, open - literalStart);
+                result.literalLength += open - literalStart;
+                ++result.segmentCount;
+            }
+            const std::basic_string_view<CharType> name = pattern.substr(nameStart, close - nameStart);
+            if (onPlaceholder(open, close + closeDelimiter.length() - open, name)) {
+                ++result.placeholderCount;
+            }
+            ++result.segmentCount;
+            literalStart = close + closeDelimiter.length();
+        }
+        if (literalStart < pattern.length()) {
+            onLiteral(literalStart, pattern.length() - literalStart);
+            result.literalLength += pattern.length() - literalStart;
+            ++result.segmentCount;
+        }
+        return result;
+    }
+
+    template<FixedString Pattern, FixedString OpenDelimiter, FixedString CloseDelimiter>
+    consteval typename BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::Layout
+    BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::measure() noexcept {
+        std::basic_string_view<CharType> seen[Pattern.getView().length() / 2 + 1]{};
+        std::size_t seenCount = 0;
+        return parse([](std::size_t, std::size_t) {},
+                     [&](std::size_t, std::size_t, std::basic_string_view<CharType> name) {
+                         if (std::find(seen, seen + seenCount, name) != seen + seenCount) {
+                             return false;
+                         }
+                         seen[seenCount++] = name;
+                         return true;
+                     });
+    }
+
+    template<FixedString Pattern, FixedString OpenDelimiter, FixedString CloseDelimiter>
+    consteval auto BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::buildNames() noexcept
+    -> std::array<std::basic_string_view<CharType>, layout.placeholderCount> {
+        std::array<std::basic_string_view<CharType>, layout.placeholderCount> names{};
+        std::size_t nameCount = 0;
+        parse([](std::size_t, std::size_t) {},
+              [&](std::size_t, std::size_t, std::basic_string_view<CharType> name) {
+                  if (std::find(names.begin(), names.begin() + nameCount, name) != names.begin() + nameCount) {
+                      return false;
+                  }
+                  names[nameCount++] = name;
+                  return true;
+              });
+        return names;
+    }
+
+    template<FixedString Pattern, FixedString OpenDelimiter, FixedString CloseDelimiter>
+    consteval auto BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::buildSegments() noexcept
+    -> std::array<Segment, layout.segmentCount> {
+        constexpr std::array<std::basic_string_view<CharType>, layout.placeholderCount> names = buildNames();
+        std::array<Segment, layout.segmentCount> segments{};
+        std::size_t segmentCount = 0;
+        parse([&](std::size_t offset, std::size_t length) {
+                  segments[segmentCount++] = {SegmentKinds::LITERAL, offset, length, 0};
+              },
+              [&](std::size_t offset, std::size_t length, std::basic_string_view<CharType> name) {
+                  const std::size_t slot = std::find(names.begin(), names.end(), name) - names.begin();
+                  segments[segmentCount++] = {SegmentKinds::PLACEHOLDER, offset, length, slot};
+                  return false;
+              });
+        return segments;
+    }
+
+    template<FixedString Pattern, FixedString OpenDelimiter, FixedString CloseDelimiter>
+    template<typename... Arguments>
+    consteval std::array<std::size_t, BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::layout.placeholderCount>
+    BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::bindArguments() noexcept {
+        constexpr std::array<std::basic_string_view<CharType>, sizeof...(Arguments)> argumentNames{Arguments::getName()...};
+        std::array<std::size_t, layout.placeholderCount> argumentIndexes{};
+        for (std::size_t slot = 0; slot < names.size(); ++slot) {
+            argumentIndexes[slot] = std::find(argumentNames.begin(), argumentNames.end(), names[slot]) -
+                                    argumentNames.begin();
+        }
+        return argumentIndexes;
+    }
+
+    template<FixedString Pattern, FixedString OpenDelimiter, FixedString CloseDelimiter>
+    template<typename... Arguments>
+    consteval bool BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::isEveryArgumentUsed() noexcept {
+        constexpr std::array<std::basic_string_view<CharType>, sizeof...(Arguments)> argumentNames{Arguments::getName()...};
+        for (std::size_t index = 0; index < argumentNames.size(); ++index) {
+            if (std::find(names.begin(), names.end(), argumentNames[index]) == names.end() ||
+                std::find(argumentNames.begin(), argumentNames.begin() + index, argumentNames[index]) !=
+                argumentNames.begin() + index) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<FixedString Pattern, FixedString OpenDelimiter, FixedString CloseDelimiter>
+    consteval std::basic_string_view<typename BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::CharType>
+    BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::getPattern() noexcept {
+        return Pattern.getView();
+    }
+
+    template<FixedString Pattern, FixedString OpenDelimiter, FixedString CloseDelimiter>
+    consteval std::size_t BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::getPlaceholderCount() noexcept {
+        return layout.placeholderCount;
+    }
+
+    template<FixedString Pattern, FixedString OpenDelimiter, FixedString CloseDelimiter>
+    consteval std::size_t BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::getLiteralLength() noexcept {
+        return layout.literalLength;
+    }
+
+    template<FixedString Pattern, FixedString OpenDelimiter, FixedString CloseDelimiter>
+    template<typename... Arguments>
+    std::basic_string<typename BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::CharType>
+    BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::render(const Arguments&... arguments) noexcept {
+        constexpr std::array<std::size_t, layout.placeholderCount> argumentIndexes = bindArguments<Arguments...>();
+        static_assert(std::find(argumentIndexes.begin(), argumentIndexes.end(), sizeof...(Arguments)) ==
+                      argumentIndexes.end(),
+                      "a placeholder of the pattern has no argument");
+        static_assert(isEveryArgumentUsed<Arguments...>(),
+                      "an argument does not name a placeholder of the pattern or is passed twice");
+        static_assert((Formattable<std::remove_cvref_t<decltype(arguments.value)>, CharType> && ...),
+                      "an argument value has no istr::Formatter specialization");
+        return renderValues(argumentIndexes, prepareFormatted(arguments.value)...);
+    }
+
+    template<FixedString Pattern, FixedString OpenDelimiter, FixedString CloseDelimiter>
+    template<typename... Values>
+    std::basic_string<typename BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::CharType>
+    BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::renderValues(
+            const std::array<std::size_t, layout.placeholderCount>& argumentIndexes, const Values&... values) noexcept {
+        std::size_t size = layout.literalLength;
+        for (const Segment& segment: segments) {
+            if (segment.kind == SegmentKinds::PLACEHOLDER) {
+                visitValueAt(argumentIndexes[segment.slot], [&size]<typename V>(const V& value) {
+                    size += Formatter<V, CharType>::getSize(value);
+                }, values...);
+            }
+        }
+
+        constexpr std::basic_string_view<CharType> pattern = Pattern.getView();
+        std::basic_string<CharType> substitution;
+        substitution.resize_and_overwrite(size, [&](CharType* data, std::size_t) {
+            CharType* cursor = data;
+            for (const Segment& segment: segments) {
+                if (segment.kind == SegmentKinds::PLACEHOLDER) {
+                    visitValueAt(argumentIndexes[segment.slot], [&cursor]<typename V>(const V& value) {
+                        cursor = Formatter<V, CharType>::format(cursor, value);
+                    }, values...);
+                } else {
+                    const std::basic_string_view<CharType> literal = pattern.substr(segment.offset, segment.length);
+                    cursor = std::copy(literal.begin(), literal.end(), cursor);
+                }
+            }
+            return static_cast<std::size_t>(cursor - data);
+        });
+        return substitution;
+    }
+
+    template<FixedString Pattern, FixedString OpenDelimiter, FixedString CloseDelimiter>
+    template<typename ValueVisitor, typename... Values>
+    void BasicFixedTemplate<Pattern, OpenDelimiter, CloseDelimiter>::visitValueAt(
+            std::size_t index, ValueVisitor&& visitor, const Values&... values) noexcept {
+        std::size_t position = 0;
+        static_cast<void>(((position++ == index && (visitor(values), true)) || ...));
+    }
+
+    template<FixedString Pattern>
+    using FixedTemplate [[maybe_unused]] = BasicFixedTemplate<Pattern, FixedString("{{"), FixedString("}}")>;
+
+    // substitutes a fixed set of literal keys in one pass over the text with an Aho-Corasick automaton built once,
+    // at every position the leftmost key wins and among keys starting at the same position the longest one,
+    // replacements are not scanned again
+    template<CharTypes T, typename Allocator = std::allocator<T>>
+    class BasicKeySubstitution {
+    public:
+        using String = typename BasicStringTemplate<T, Allocator>::String;
+        using Arguments = typename BasicStringTemplate<T, Allocator>::Arguments;
+
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        explicit BasicKeySubstitution(const Arguments& replacements, const Allocator& allocator = Allocator()) noexcept;
+
+        Allocator getAllocator() const noexcept;
+
+        std::size_t getKeyCount() const noexcept;
+
+        std::size_t getStateCount() const noexcept;
+
+        // replaces the replacement of a key without building the automaton again, false if it is not a key
+        bool setReplacement(std::basic_string_view<T> key, const String& replacement) noexcept;
+
+        template<std::invocable<std::basic_string_view<T>> Sink>
+        void substitute(std::basic_string_view<T> text, Sink&& sink) const noexcept;
+
+        String substitute(std::basic_string_view<T> text) const noexcept;
+
+        void substituteTo(String& output, std::basic_string_view<T> text) const noexcept;
+
+    private:
+        template<typename U>
+        using RebindAllocator = typename BasicStringTemplate<T, Allocator>::template RebindAllocator<U>;
+
+        struct State {
+            std::size_t firstTransition;
+            std::size_t transitionCount;
+            std::size_t failure;
+            // the longest key that is a suffix of the state, npos if there is none
+            std::size_t key;
+            std::size_t depth;
+        };
+
+        struct Transition {
+            T character;
+            std::size_t state;
+        };
+
+        std::size_t findTransition(std::size_t state, T character) const noexcept;
+
+        std::size_t getNextState(std::size_t state, T character) const noexcept;
+
+        std::vector<String, RebindAllocator<String>> replacements;
+        std::vector<std::size_t, RebindAllocator<std::size_t>> keyLengths;
+        std::vector<State, RebindAllocator<State>> states;
+        std::vector<Transition, RebindAllocator<Transition>> transitions;
+        // the first characters of the keys, text before the next of them cannot start a match
+        String firstCharacters;
+    };
+
+    template<CharTypes T, typename Allocator>
+    BasicKeySubstitution<T, Allocator>::BasicKeySubstitution(const Arguments& replacements,
+                                                             const Allocator& allocator) noexcept :
+            replacements(allocator), keyLengths(allocator), states(allocator), transitions(allocator),
+            firstCharacters(allocator) {
+        using Children = std::map<T, std::size_t, std::less<T>, RebindAllocator<std::pair<const T, std::size_t>>>;
+        std::vector<Children, RebindAllocator<Children>> trie(1, Children(allocator), allocator);
+        std::vector<std::size_t, RebindAllocator<std::size_t>> trieKeys(1, npos, allocator);
+        for (const auto& [key, replacement]: replacements) {
+            if (key.empty()) {
+                continue;
+            }
+            std::size_t node = 0;
+            for (const T character: key) {
+                const auto [child, inserted] = trie[node].try_emplace(character, trie.size());
+                if (inserted) {
+                    trie.emplace_back();
+                    trieKeys.push_back(npos);
+                }
+                node = child->second;
+            }
+            trieKeys[node] = this->replacements.size();
+            this->replacements.push_back(replacement);
+            this->keyLengths.push_back(key.length());
+        }
+
+        // states are numbered breadth first, so the failure state of every state is already complete
+        std::vector<std::size_t, RebindAllocator<std::size_t>> trieNodes(1, 0, allocator);
+        trieNodes.reserve(trie.size());
+        this->states.reserve(trie.size());
+        this->transitions.reserve(trie.size() - 1);
+        this->states.push_back({0, 0, 0, trieKeys[0], 0});
+        for (std::size_t state = 0; state < trieNodes.size(); ++state) {
+            this->states[state].firstTransition = this->transitions.size();
+            for (const auto& [character, child]: trie[trieNodes[state]]) {
+                this->transitions.push_back({character, trieNodes.size()});
+                this->states.push_back({0, 0, 0, npos, this->states[state].depth + 1});
+                trieNodes.push_back(child);
+            }
+            this->states[state].transitionCount = this->transitions.size() - this->states[state].firstTransition;
+            if (state == 0) {
+                for (const Transition& transition: this->transitions) {
+                    this->firstCharacters.push_back(transition.character);
+                }
+            }
+            for (std::size_t index = this->states[state].firstTransition; index < this->transitions.size(); ++index) {
+                const Transition& transition = this->transitions[index];
+                const std::size_t failure = state == 0
+                                            ? 0
+                                            : this->getNextState(this->states[state].failure, transition.character);
+                State& next = this->states[transition.state];
+                next.failure = failure;
+                next.key = trieKeys[trieNodes[transition.state]] != npos
+                           ? trieKeys[trieNodes[transition.state]]
+                           : this->states[failure].key;
+            }
+        }
+    }
+
+    template<CharTypes T, typename Allocator>
+    Allocator BasicKeySubstitution<T, Allocator>::getAllocator() const noexcept {
+        return this->states.get_allocator();
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicKeySubstitution<T, Allocator>::getKeyCount() const noexcept {
+        return this->keyLengths.size();
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicKeySubstitution<T, Allocator>::getStateCount() const noexcept {
+        return this->states.size();
+    }
+
+    template<CharTypes T, typename Allocator>
+    bool BasicKeySubstitution<T, Allocator>::setReplacement(std::basic_string_view<T> key,
+                                                            const String& replacement) noexcept {
+        std::size_t state = 0;
+        for (const T character: key) {
+            state = this->findTransition(state, character);
+            if (state == npos) {
+                return false;
+            }
+        }
+        const std::size_t index = this->states[state].key;
+        if (key.empty() || index == npos || this->keyLengths[index] != key.length()) {
+            return false;
+        }
+        this->replacements[index] = replacement;
+        return true;
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicKeySubstitution<T, Allocator>::findTransition(std::size_t state, T character) const noexcept {
+        const auto first = this->transitions.begin() + static_cast<std::ptrdiff_t>(this->states[state].firstTransition);
+        const auto last = first + static_cast<std::ptrdiff_t>(this->states[state].transitionCount);
+        const auto transition = std::lower_bound(first, last, character,
+                                                 [](const Transition& transition, T character) {
+                                                     return transition.character < character;
+                                                 });
+        return transition != last && transition->character == character ? transition->state : npos;
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::size_t BasicKeySubstitution<T, Allocator>::getNextState(std::size_t state, T character) const noexcept {
+        while (true) {
+            const std::size_t next = this->findTransition(state, character);
+            if (next != npos) {
+                return next;
+            }
+            if (state == 0) {
+                return 0;
+            }
+            state = this->states[state].failure;
+        }
+    }
+
+    // the best match so far is final once the automaton state no longer reaches back to its start,
+    // scanning then resumes right after the match
+    template<CharTypes T, typename Allocator>
+    template<std::invocable<std::basic_string_view<T>> Sink>
+    void BasicKeySubstitution<T, Allocator>::substitute(std::basic_string_view<T> text, Sink&& sink) const noexcept {
+        const auto emit = [&sink](std::basic_string_view<T> fragment) {
+            if (!fragment.empty()) {
+                sink(fragment);
+            }
+        };
+        std::size_t literalStart = 0;
+        std::size_t matchStart = npos, matchEnd = 0, matchKey = npos;
+        std::size_t state = 0;
+        std::size_t index = 0;
+        while (true) {
+            if (state == 0 && matchStart == npos && index < text.length()) {
+                index = this->firstCharacters.length() == 1 ? text.find(this->firstCharacters.front(), index)
+                                                            : text.find_first_of(this->firstCharacters, index);
+                index = std::min(index, text.length());
+            }
+            if (index < text.length()) {
+                state = this->getNextState(state, text[index++]);
+                const std::size_t key = this->states[state].key;
+                if (key != npos && index - this->keyLengths[key] <= matchStart) {
+                    matchStart = index - this->keyLengths[key];
+                    matchEnd = index;
+                    matchKey = key;
+                }
+                if (matchStart == npos || index - this->states[state].depth <= matchStart) {
+                    continue;
+                }
+            } else if (matchStart == npos) {
+                break;
+            }
+            emit(text.substr(literalStart, matchStart - literalStart));
+            emit(this->replacements[matchKey]);
+            literalStart = matchEnd;
+            index = matchEnd;
+            state = 0;
+            matchStart = npos;
+        }
+        emit(text.substr(literalStart));
+    }
+
+    template<CharTypes T, typename Allocator>
+    typename BasicKeySubstitution<T, Allocator>::String
+    BasicKeySubstitution<T, Allocator>::substitute(std::basic_string_view<T> text) const noexcept {
+        String substitution(this->getAllocator());
+        this->substituteTo(substitution, text);
+        return substitution;
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicKeySubstitution<T, Allocator>::substituteTo(String& output, std::basic_string_view<T> text) const noexcept {
+        output.reserve(output.length() + text.length());
+        this->substitute(text, [&output](std::basic_string_view<T> fragment) {
+            output.append(fragment);
+        });
+    }
+
+#if defined(STRING_INTERPOLATION_ENABLE_INSTRUMENTATION)
+    struct RenderStatistics {
+        static constexpr std::size_t latencyBuckets = 32;
+
+        std::uint64_t renders;
+        std::uint64_t cacheHits;
+        std::uint64_t bytes;
+        // renders that had to grow the output string
+        std::uint64_t allocations;
+        // bucket i counts the renders that took less than 2^i and at least 2^(i - 1) nanoseconds,
+        // the last bucket also counts the longer ones
+        std::array<std::uint64_t, latencyBuckets> latencyHistogram;
+    };
+
+    // every counter is a relaxed atomic, they are updated without locks from any number of threads
+    class RenderCounters {
+    public:
+        RenderCounters() noexcept = default;
+
+        RenderCounters(const RenderCounters& counters) noexcept;
+
+        RenderCounters& operator=(const RenderCounters& counters) noexcept;
+
+        static RenderCounters& getGlobal() noexcept;
+
+        void recordRender(std::size_t bytes, bool allocated, std::chrono::nanoseconds latency) noexcept;
+
+        void recordCacheHit() noexcept;
+
+        RenderStatistics getStatistics() const noexcept;
+
+        void reset() noexcept;
+
+    private:
+        std::atomic<std::uint64_t> renders{0};
+        std::atomic<std::uint64_t> cacheHits{0};
+        std::atomic<std::uint64_t> bytes{0};
+        std::atomic<std::uint64_t> allocations{0};
+        std::array<std::atomic<std::uint64_t>, RenderStatistics::latencyBuckets> latencyHistogram{};
+    };
+
+    inline RenderCounters::RenderCounters(const RenderCounters& counters) noexcept {
+        *this = counters;
+    }
+
+    inline RenderCounters& RenderCounters::operator=(const RenderCounters& counters) noexcept {
+        const RenderStatistics statistics = counters.getStatistics();
+        this->renders.store(statistics.renders, std::memory_order_relaxed);
+        this->cacheHits.store(statistics.cacheHits, std::memory_order_relaxed);
+        this->bytes.store(statistics.bytes, std::memory_order_relaxed);
+        this->allocations.store(statistics.allocations, std::memory_order_relaxed);
+        for (std::size_t bucket = 0; bucket < RenderStatistics::latencyBuckets; ++bucket) {
+            this->latencyHistogram[bucket].store(statistics.latencyHistogram[bucket], std::memory_order_relaxed);
+        }
+        return *this;
+    }
+
+    inline RenderCounters& RenderCounters::getGlobal() noexcept {
+        static RenderCounters counters;
+        return counters;
+    }
+
+    inline void RenderCounters::recordRender(std::size_t bytes, bool allocated,
+                                             std::chrono::nanoseconds latency) noexcept {
+        const auto nanoseconds = static_cast<std::uint64_t>(std::max<std::chrono::nanoseconds::rep>(latency.count(), 0));
+        const std::size_t bucket = std::min<std::size_t>(std::bit_width(nanoseconds), RenderStatistics::latencyBuckets - 1);
+        this->renders.fetch_add(1, std::memory_order_relaxed);
+        this->bytes.fetch_add(bytes, std::memory_order_relaxed);
+        this->allocations.fetch_add(allocated ? 1 : 0, std::memory_order_relaxed);
+        this->latencyHistogram[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    inline void RenderCounters::recordCacheHit() noexcept {
+        this->cacheHits.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    inline RenderStatistics RenderCounters::getStatistics() const noexcept {
+        RenderStatistics statistics{this->renders.load(std::memory_order_relaxed),
+                                    this->cacheHits.load(std::memory_order_relaxed),
+                                    this->bytes.load(std::memory_order_relaxed),
+                                    this->allocations.load(std::memory_order_relaxed), {}};
+        for (std::size_t bucket = 0; bucket < RenderStatistics::latencyBuckets; ++bucket) {
+            statistics.latencyHistogram[bucket] = this->latencyHistogram[bucket].load(std::memory_order_relaxed);
+        }
+        return statistics;
+    }
+
+    inline void RenderCounters::reset() noexcept {
+        *this = RenderCounters();
+    }
+
+    // the interpolation is the BasicStringInterpolation being rendered, bytes and latency are zero in begin
+    template<CharTypes T>
+    struct BasicRenderEvent {
+        const void* interpolation;
+        std::basic_string_view<T> pattern;
+        std::size_t bytes;
+        std::chrono::nanoseconds latency;
+    };
+
+    // the hooks are called around every render on the rendering thread, the installed hooks must stay alive
+    // until they are replaced
+    template<CharTypes T>
+    struct BasicRenderHooks {
+        using Hook = void (*)(const BasicRenderEvent<T>& event, void* context);
+
+        Hook begin = nullptr;
+        Hook end = nullptr;
+        void* context = nullptr;
+
+        static const BasicRenderHooks<T>* getGlobal() noexcept;
+
+        static void setGlobal(const BasicRenderHooks<T>* hooks) noexcept;
+
+    private:
+        static std::atomic<const BasicRenderHooks<T>*>& getInstalled() noexcept;
+    };
+
+    template<CharTypes T>
+    std::atomic<const BasicRenderHooks<T>*>& BasicRenderHooks<T>::getInstalled() noexcept {
+        static std::atomic<const BasicRenderHooks<T>*> installed{nullptr};
+        return installed;
+    }
+
+    template<CharTypes T>
+    const BasicRenderHooks<T>* BasicRenderHooks<T>::getGlobal() noexcept {
+        return getInstalled().load(std::memory_order_acquire);
+    }
+
+    template<CharTypes T>
+    void BasicRenderHooks<T>::setGlobal(const BasicRenderHooks<T>* hooks) noexcept {
+        getInstalled().store(hooks, std::memory_order_release);
+    }
+#endif
+
+    enum class ValidationErrors {
+        EMPTY_PATTERN = 1,
+        NO_ARGUMENTS,
+        MISSING_ARGUMENTS,
+        UNUSED_ARGUMENTS,
+        UNTERMINATED_PLACEHOLDERS
+    };
+
+    template<CharTypes T, typename Allocator = std::allocator<T>>
+    class BasicStringInterpolation;
+
+    // the bitsets are only allocated for the kinds of error found, a valid report owns no memory
+    template<CharTypes T, typename Allocator = std::allocator<T>>
+    class BasicValidationReport {
+    public:
+        using Bits = std::vector<bool, typename std::allocator_traits<Allocator>::template rebind_alloc<bool>>;
+
+        explicit BasicValidationReport(const Allocator& allocator = Allocator()) noexcept;
+
+        bool isValid() const noexcept;
+
+        bool hasError(ValidationErrors error) const noexcept;
+
+        // the first error in the order of ValidationErrors
+        std::expected<void, ValidationErrors> getResult() const noexcept;
+
+        // indexed by the placeholder slots of the compiled template
+        const Bits& getMissingPlaceholders() const noexcept;
+
+        // indexed by the position of the argument in the argument map
+        const Bits& getUnusedArguments() const noexcept;
+
+    private:
+        friend class BasicStringInterpolation<T, Allocator>;
+
+        void clear() noexcept;
+
+        void addError(ValidationErrors error) noexcept;
+
+        static void setBit(Bits& bits, std::size_t size, std::size_t index) noexcept;
+
+        std::uint32_t errors = 0;
+        Bits missingPlaceholders;
+        Bits unusedArguments;
+    };
+
+    template<CharTypes T, typename Allocator>
+    BasicValidationReport<T, Allocator>::BasicValidationReport(const Allocator& allocator) noexcept :
+            missingPlaceholders(allocator), unusedArguments(allocator) {
+    }
+
+    template<CharTypes T, typename Allocator>
+    bool BasicValidationReport<T, Allocator>::isValid() const noexcept {
+        return this->errors == 0;
+    }
+
+    template<CharTypes T, typename Allocator>
+    bool BasicValidationReport<T, Allocator>::hasError(ValidationErrors error) const noexcept {
+        return (this->errors & (std::uint32_t(1) << static_cast<std::uint32_t>(error))) != 0;
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::expected<void, ValidationErrors> BasicValidationReport<T, Allocator>::getResult() const noexcept {
+        if (this->isValid()) {
+            return {};
+        }
+        return std::unexpected(static_cast<ValidationErrors>(std::countr_zero(this->errors)));
+    }
+
+    template<CharTypes T, typename Allocator>
+    const typename BasicValidationReport<T, Allocator>::Bits&
+    BasicValidationReport<T, Allocator>::getMissingPlaceholders() const noexcept {
+        return this->missingPlaceholders;
+    }
 
-    template<CharTypes T>
+    template<CharTypes T, typename Allocator>
+    const typename BasicValidationReport<T, Allocator>::Bits&
+    BasicValidationReport<T, Allocator>::getUnusedArguments() const noexcept {
+        return this->unusedArguments;
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicValidationReport<T, Allocator>::clear() noexcept {
+        this->errors = 0;
+        this->missingPlaceholders.clear();
+        this->unusedArguments.clear();
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicValidationReport<T, Allocator>::addError(ValidationErrors error) noexcept {
+        this->errors |= std::uint32_t(1) << static_cast<std::uint32_t>(error);
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicValidationReport<T, Allocator>::setBit(Bits& bits, std::size_t size, std::size_t index) noexcept {
+        if (bits.empty()) {
+            bits.assign(size, false);
+        }
+        bits[index] = true;
+    }
+
+    template<CharTypes T, typename Allocator>
     class BasicStringInterpolation {
     public:
+        using String = typename BasicStringTemplate<T, Allocator>::String;
+        using Arguments = typename BasicStringTemplate<T, Allocator>::Arguments;
+        using Fragments = typename BasicStringTemplate<T, Allocator>::Fragments;
+        using ArgumentProvider = std::function<String()>;
+        using ValidationCallback = std::function<void(const BasicValidationReport<T, Allocator>&)>;
+
         BasicStringInterpolation() noexcept;
 
-        BasicStringInterpolation(const std::basic_string<T>& pattern,
-                                          const std::map<std::basic_string<T>,std::basic_string<T>>& patternArguments,
-                                          const std::basic_string<T>& openDelimiter,
-                                          const std::basic_string<T>& closeDelimiter) noexcept;
+        explicit BasicStringInterpolation(const Allocator& allocator) noexcept;
+
+        BasicStringInterpolation(const String& pattern,
+                                 const Arguments& patternArguments,
+                                 const String& openDelimiter,
+                                 const String& closeDelimiter,
+                                 const Allocator& allocator = Allocator()) noexcept;
 
         BasicStringInterpolation(
-                const std::basic_string<T>& pattern,
-                const std::map<std::basic_string<T>, std::basic_string<T>>& patternArguments) noexcept;
+                const String& pattern,
+                const Arguments& patternArguments,
+                const Allocator& allocator = Allocator()) noexcept;
 
         BasicStringInterpolation(
-                const std::basic_string<T>& pattern) noexcept;
+                const String& pattern,
+                const Allocator& allocator = Allocator()) noexcept;
 
         BasicStringInterpolation(
-                const std::basic_string<T>& pattern,
-                const std::basic_string<T>& openDelimiter,
-                const std::basic_string<T>& closeDelimiter) noexcept;
+                const String& pattern,
+                const String& openDelimiter,
+                const String& closeDelimiter,
+                const Allocator& allocator = Allocator()) noexcept;
 
-        BasicStringInterpolation(SubstitutionPreparationModes mode) noexcept;
+        BasicStringInterpolation(SubstitutionPreparationModes mode, const Allocator& allocator = Allocator()) noexcept;
 
-        BasicStringInterpolation(const std::basic_string<T>& pattern,
-                                          const std::map<std::basic_string<T>,std::basic_string<T>>& patternArguments,
-                                          const std::basic_string<T>& openDelimiter,
-                                          const std::basic_string<T>& closeDelimiter, SubstitutionPreparationModes mode) noexcept;
+        BasicStringInterpolation(const String& pattern,
+                                 const Arguments& patternArguments,
+                                 const String& openDelimiter,
+                                 const String& closeDelimiter, SubstitutionPreparationModes mode,
+                                 const Allocator& allocator = Allocator()) noexcept;
 
         BasicStringInterpolation(
-                const std::basic_string<T>& pattern,
-                const std::map<std::basic_string<T>, std::basic_string<T>>& patternArguments,
-                SubstitutionPreparationModes mode) noexcept;
+                const String& pattern,
+                const Arguments& patternArguments,
+                SubstitutionPreparationModes mode,
+                const Allocator& allocator = Allocator()) noexcept;
 
         BasicStringInterpolation(
-                const std::basic_string<T>& pattern,
-                const std::basic_string<T>& openDelimiter,
-                const std::basic_string<T>& closeDelimiter, SubstitutionPreparationModes mode) noexcept;
+                const String& pattern,
+                const String& openDelimiter,
+                const String& closeDelimiter, SubstitutionPreparationModes mode,
+                const Allocator& allocator = Allocator()) noexcept;
+
+        BasicStringInterpolation(const String& pattern, SubstitutionPreparationModes mode,
+                                 const Allocator& allocator = Allocator()) noexcept;
+
+        Allocator getAllocator() const noexcept;
 
-        BasicStringInterpolation(const std::basic_string<T>& pattern, SubstitutionPreparationModes mode) noexcept;
+        static const String& getDefaultOpenDelimiter() noexcept;
 
-        static const std::basic_string<T>& getDefaultOpenDelimiter() noexcept;
+        static const String& getDefaultCloseDelimiter() noexcept;
 
-        static const std::basic_string<T>& getDefaultCloseDelimiter() noexcept;
+        const String& getOpenDelimiter() const noexcept;
 
-        const std::basic_string<T>& getOpenDelimiter() const noexcept;
+        void setOpenDelimiter(const String& openDelimiter) const noexcept;
 
-        void setOpenDelimiter(const std::basic_string<T>& openDelimiter) const noexcept;
+        const String& getCloseDelimiter() const noexcept;
 
-        const std::basic_string<T>& getCloseDelimiter() const noexcept;
+        void setCloseDelimiter(const String& closeDelimiter) const noexcept;
 
-        void setCloseDelimiter(const std::basic_string<T>& closeDelimiter) const noexcept;
+        const String& getPattern() const noexcept;
 
-        const std::basic_string<T>& getPattern() const noexcept;
+        void setPattern(const String& pattern) noexcept;
 
-        void setPattern(const std::basic_string<T>& pattern) noexcept;
+        const Arguments& getPatternArguments() const noexcept;
 
-        const std::map<std::basic_string<T>, std::basic_string<T>>&
-        getPatternArguments() const noexcept;
+        // putting the same placeholder again replaces its value, the next substitution only writes the changed
+        // placeholders again
+        void putPatternArgument(const String& replaceable,
+                                const String& replacement) const noexcept;
 
-        void putPatternArgument(const std::basic_string<T>& replaceable,
-                                const std::basic_string<T>& replacement) const noexcept;
+        void putPatternArguments(const Arguments& patternArguments) const noexcept;
 
-        void putPatternArguments(const std::map<std::basic_string<T>, std::basic_string<T>>& patternArguments) const noexcept;
+        // the provider is called while substituting, once per substitution and only if the pattern contains
+        // the placeholder, its value replaces the placeholder like an argument put with putPatternArgument.
+        // EVALUATE_ONCE keeps the first value, putPatternArgument on the same placeholder removes the provider
+        void putPatternArgumentProvider(
+                const String& replaceable, ArgumentProvider provider,
+                ArgumentProviderModes mode = ArgumentProviderModes::EVALUATE_EVERY_SUBSTITUTION) const noexcept;
 
-        const std::basic_string<T> getSubstituted() const noexcept;
+        const String& getSubstituted() const noexcept;
 
-        BasicStringInterpolation<T>& operator+=(const BasicStringInterpolation<T>& templateBasicString) noexcept;
+        void appendSubstitutedTo(String& output) const noexcept;
 
-        void setOpenAndCloseDelimiters(const std::basic_string<T>& openDelimiter,
-                                       const std::basic_string<T>& closeDelimiter) const noexcept;
+        // the fragments stay valid until this object is modified or destroyed
+        Fragments getSubstitutedFragments() const noexcept;
+
+        // joins the compiled templates without parsing the patterns again, the placeholders of each operand keep
+        // their own delimiters. changing the pattern or the delimiters afterwards compiles the joined pattern again
+        BasicStringInterpolation<T, Allocator>& operator+=(
+                const BasicStringInterpolation<T, Allocator>& templateBasicString) noexcept;
+
+        void setOpenAndCloseDelimiters(const String& openDelimiter,
+                                       const String& closeDelimiter) const noexcept;
 
         SubstitutionPreparationModes getSubstitutionPreparationMode() const noexcept;
 
@@ -108,283 +3049,1162 @@ namespace istr {
 
         void prepareSubstitution() const noexcept;
 
+        std::expected<void, ValidationErrors> validate() const noexcept;
+
+        const BasicValidationReport<T, Allocator>& getValidationReport() const noexcept;
+
+        // called with WITH_REPLACEMENT_VALIDATION when a substitution finds the pattern or the arguments invalid,
+        // once until the pattern, the delimiters or the arguments change
+        void setValidationCallback(ValidationCallback validationCallback) const noexcept;
+
+        std::shared_ptr<const BasicStringTemplate<T, Allocator>> getTemplate() const noexcept;
+
+#if defined(STRING_INTERPOLATION_ENABLE_INSTRUMENTATION)
+        // the renders of this object, they are also added to RenderCounters::getGlobal()
+        const RenderCounters& getRenderCounters() const noexcept;
+#endif
+
     private:
-        void tryPrepareSubstitution() const noexcept(false);
+        struct PatternArgumentProvider {
+            ArgumentProvider provider;
+            ArgumentProviderModes mode;
+            bool evaluated = false;
+        };
+
+        using PatternArgumentProviders = std::map<String, PatternArgumentProvider, std::less<String>,
+                typename BasicStringTemplate<T, Allocator>::template RebindAllocator<
+                        std::pair<const String, PatternArgumentProvider>>>;
+
+        void validateSubstitution() const noexcept;
+
+        void prepareRawSubstitution() const noexcept;
+
+        void renderSubstitution() const noexcept;
 
-        std::basic_string<T> validateReplaceable(const std::basic_string<T>& replaceable) const noexcept;
+        void updateSubstitution() const noexcept;
+
+        const String& refreshSubstitution() const noexcept;
+
+        void evaluatePatternArgumentProviders() const noexcept;
+
+        void storePatternArgument(const String& validReplaceable, const String& replacement) const noexcept;
+
+        void renderSegmentsFrom(std::size_t firstSegment) const noexcept;
+
+        // measures the render when instrumentation is enabled, the output grows from offset
+        template<typename Render>
+        void recordRender(const String& output, std::size_t offset, Render&& render) const noexcept;
+
+        void recordCacheHit() const noexcept;
+
+        void invalidateSubstitution() const noexcept;
+
+        const BasicStringTemplate<T, Allocator>& getCompiledTemplate() const noexcept;
+
+        std::shared_ptr<const BasicStringTemplate<T, Allocator>> compileTemplate() const noexcept;
+
+        // the compiled pattern, compiled on first use after the pattern or a delimiter changed, so a sequence of
+        // setters compiles and caches only its final pattern and delimiters. The first use can be getTemplate()
+        // from many threads at once, the template is then compiled by one of them under the lock
+        class LazyTemplate {
+        public:
+            LazyTemplate() noexcept = default;
+
+            LazyTemplate(const LazyTemplate& lazyTemplate) noexcept;
+
+            LazyTemplate& operator=(const LazyTemplate& lazyTemplate) noexcept;
+
+            template<typename Compile>
+            const std::shared_ptr<const BasicStringTemplate<T, Allocator>>& get(Compile&& compile) const noexcept;
+
+            void set(std::shared_ptr<const BasicStringTemplate<T, Allocator>> compiledTemplate) noexcept;
+
+            void reset() noexcept;
+
+        private:
+            mutable std::mutex mutex;
+            mutable std::atomic<bool> compiled{false};
+            mutable std::shared_ptr<const BasicStringTemplate<T, Allocator>> compiledTemplate;
+        };
+
+        // the argument keys are searched in the pattern with empty delimiters, any other delimiters are paired
+        // by the compiled template, identical ones too, so StringTemplate renders the same pattern alike
+        bool usesKeySubstitution() const noexcept;
+
+        bool containsReplaceable(const String& replaceable) const noexcept;
+
+        String validateReplaceable(const String& replaceable) const noexcept;
 
         mutable bool alreadySubstituted = false;
-        std::basic_string<T> pattern;
-        mutable std::basic_string<T> substitution;
-        mutable std::map<std::basic_string<T>, std::basic_string<T>> patternArguments;
-        static std::basic_string<T> defaultOpenDelimiter, defaultCloseDelimiter;
-        mutable std::basic_string<T> openDelimiter, closeDelimiter;
+        String pattern;
+        mutable String substitution;
+        mutable Arguments patternArguments;
+        mutable PatternArgumentProviders patternArgumentProviders;
+        static String defaultOpenDelimiter, defaultCloseDelimiter;
+        mutable String openDelimiter, closeDelimiter;
         mutable SubstitutionPreparationModes substitutionPreparationMode;
+        mutable BasicValidationReport<T, Allocator> validationReport;
+        mutable bool alreadyValidated = false;
+        mutable ValidationCallback validationCallback;
+        mutable LazyTemplate compiledTemplate;
+        // the automaton over the argument keys used with empty delimiters, rebuilt when a key is added
+        mutable std::shared_ptr<BasicKeySubstitution<T, Allocator>> keySubstitution;
+        // output offset of every segment of the last substitution and the slots changed since
+        mutable std::vector<std::size_t, typename BasicStringTemplate<T, Allocator>::template RebindAllocator<std::size_t>>
+                segmentOffsets;
+        mutable std::vector<bool, typename BasicStringTemplate<T, Allocator>::template RebindAllocator<bool>> dirtySlots;
+        mutable bool hasDirtySlots = false;
+#if defined(STRING_INTERPOLATION_ENABLE_INSTRUMENTATION)
+        mutable RenderCounters renderCounters;
+#endif
     };
 
-    template<CharTypes T>
-    std::basic_string<T> BasicStringInterpolation<T>::defaultOpenDelimiter(
-            static_cast<std::basic_string<T>>("{{"));
-    template<CharTypes T>
-    std::basic_string<T> BasicStringInterpolation<T>::defaultCloseDelimiter(
-            static_cast<std::basic_string<T>>("}}"));
+    template<CharTypes T, typename Allocator>
+    typename BasicStringInterpolation<T, Allocator>::String
+    BasicStringInterpolation<T, Allocator>::defaultOpenDelimiter(
+            static_cast<String>("{{"));
+    template<CharTypes T, typename Allocator>
+    typename BasicStringInterpolation<T, Allocator>::String
+    BasicStringInterpolation<T, Allocator>::defaultCloseDelimiter(
+            static_cast<String>("}}"));
 
-    template<CharTypes T>
-    void BasicStringInterpolation<T>::prepareSubstitution() const noexcept {
-        if (this->getSubstitutionPreparationMode() == SubstitutionPreparationModes::WITH_REPLACEMENT_VALIDATION) {
-            this->tryPrepareSubstitution();
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::prepareSubstitution() const noexcept {
+        this->evaluatePatternArgumentProviders();
+        this->recordRender(this->substitution, 0, [this]() {
+            this->renderSubstitution();
+        });
+    }
+
+    template<CharTypes T, typename Allocator>
+    template<typename Render>
+    void BasicStringInterpolation<T, Allocator>::recordRender(const String& output, std::size_t offset,
+                                                              Render&& render) const noexcept {
+#if defined(STRING_INTERPOLATION_ENABLE_INSTRUMENTATION)
+        const BasicRenderHooks<T>* hooks = BasicRenderHooks<T>::getGlobal();
+        BasicRenderEvent<T> event{this, this->getPattern(), 0, std::chrono::nanoseconds(0)};
+        if (hooks != nullptr && hooks->begin != nullptr) {
+            hooks->begin(event, hooks->context);
         }
-        this->substitution = this->getPattern();
-        for (const auto& [replaceable, replacement]: this->getPatternArguments()) {
-            int start_position = 0;
-            while ((start_position = this->substitution.find(replaceable, start_position)) !=
-                    std::basic_string< T, std::char_traits<T>, std::allocator<T>> ::npos) {
-                this->substitution.replace(start_position, replaceable.length(), replacement);
-                start_position += replacement.length();
-            }
+        const std::size_t capacity = output.capacity();
+        const auto start = std::chrono::steady_clock::now();
+        render();
+        event.latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        event.bytes = output.length() - std::min(offset, output.length());
+        this->renderCounters.recordRender(event.bytes, output.capacity() != capacity, event.latency);
+        RenderCounters::getGlobal().recordRender(event.bytes, output.capacity() != capacity, event.latency);
+        if (hooks != nullptr && hooks->end != nullptr) {
+            hooks->end(event, hooks->context);
+        }
+#else
+        (void) output;
+        (void) offset;
+        render();
+#endif
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::recordCacheHit() const noexcept {
+#if defined(STRING_INTERPOLATION_ENABLE_INSTRUMENTATION)
+        this->renderCounters.recordCacheHit();
+        RenderCounters::getGlobal().recordCacheHit();
+#endif
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::renderSubstitution() const noexcept {
+        this->validateSubstitution();
+        if (this->usesKeySubstitution()) {
+            this->prepareRawSubstitution();
+        } else {
+            const BasicStringTemplate<T, Allocator>& compiledTemplate = this->getCompiledTemplate();
+            this->substitution.clear();
+            this->substitution.reserve(compiledTemplate.getRenderedSize(this->getPatternArguments()));
+            this->segmentOffsets.assign(compiledTemplate.getSegments().size() + 1, 0);
+            this->renderSegmentsFrom(0);
+            this->dirtySlots.assign(compiledTemplate.getPlaceholders().size(), false);
         }
+        this->hasDirtySlots = false;
         this->alreadySubstituted = true;
     }
 
-    template<CharTypes T>
-    std::basic_string<T> BasicStringInterpolation<T>::validateReplaceable(const std::basic_string<T>& replaceable) const noexcept {
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::renderSegmentsFrom(std::size_t firstSegment) const noexcept {
+        const BasicStringTemplate<T, Allocator>& compiledTemplate = this->getCompiledTemplate();
+        const auto& segments = compiledTemplate.getSegments();
+        this->substitution.resize(this->segmentOffsets[firstSegment]);
+        for (std::size_t index = firstSegment; index < segments.size(); ++index) {
+            this->segmentOffsets[index] = this->substitution.length();
+            const auto& segment = segments[index];
+            const auto replacement = segment.kind == SegmentKinds::PLACEHOLDER
+                                     ? this->patternArguments.find(compiledTemplate.getPlaceholders()[segment.slot].replaceable)
+                                     : this->patternArguments.end();
+            if (replacement != this->patternArguments.end()) {
+                this->substitution.append(replacement->second);
+            } else {
+                this->substitution.append(compiledTemplate.getSegmentView(segment));
+            }
+        }
+        this->segmentOffsets[segments.size()] = this->substitution.length();
+    }
+
+    // replacements that kept their length are overwritten in place,
+    // otherwise the substitution is rendered again from the first changed placeholder
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::updateSubstitution() const noexcept {
+        this->validateSubstitution();
+        const BasicStringTemplate<T, Allocator>& compiledTemplate = this->getCompiledTemplate();
+        const auto& segments = compiledTemplate.getSegments();
+        for (std::size_t index = 0; index < segments.size(); ++index) {
+            const auto& segment = segments[index];
+            if (segment.kind != SegmentKinds::PLACEHOLDER || !this->dirtySlots[segment.slot]) {
+                continue;
+            }
+            const String& replacement =
+                    this->patternArguments.find(compiledTemplate.getPlaceholders()[segment.slot].replaceable)->second;
+            if (replacement.length() != this->segmentOffsets[index + 1] - this->segmentOffsets[index]) {
+                this->renderSegmentsFrom(index);
+                break;
+            }
+            std::copy(replacement.begin(), replacement.end(), this->substitution.begin() +
+                                                              static_cast<std::ptrdiff_t>(this->segmentOffsets[index]));
+        }
+        this->dirtySlots.assign(this->dirtySlots.size(), false);
+        this->hasDirtySlots = false;
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::invalidateSubstitution() const noexcept {
+        this->alreadySubstituted = false;
+        this->hasDirtySlots = false;
+        this->alreadyValidated = false;
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::prepareRawSubstitution() const noexcept {
+        if (!this->keySubstitution) {
+            this->keySubstitution = std::allocate_shared<BasicKeySubstitution<T, Allocator>>(
+                    this->getAllocator(), this->getPatternArguments(), this->getAllocator());
+        }
+        this->substitution.clear();
+        this->keySubstitution->substituteTo(this->substitution, this->getPattern());
+    }
+
+    template<CharTypes T, typename Allocator>
+    BasicStringInterpolation<T, Allocator>::LazyTemplate::LazyTemplate(const LazyTemplate& lazyTemplate) noexcept {
+        *this = lazyTemplate;
+    }
+
+    template<CharTypes T, typename Allocator>
+    typename BasicStringInterpolation<T, Allocator>::LazyTemplate&
+    BasicStringInterpolation<T, Allocator>::LazyTemplate::operator=(const LazyTemplate& lazyTemplate) noexcept {
+        if (this != &lazyTemplate) {
+            std::scoped_lock lock(this->mutex, lazyTemplate.mutex);
+            this->compiledTemplate = lazyTemplate.compiledTemplate;
+            this->compiled.store(lazyTemplate.compiled.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        return *this;
+    }
+
+    template<CharTypes T, typename Allocator>
+    template<typename Compile>
+    const std::shared_ptr<const BasicStringTemplate<T, Allocator>>&
+    BasicStringInterpolation<T, Allocator>::LazyTemplate::get(Compile&& compile) const noexcept {
+        if (!this->compiled.load(std::memory_order_acquire)) {
+            std::scoped_lock lock(this->mutex);
+            if (!this->compiled.load(std::memory_order_relaxed)) {
+                this->compiledTemplate = compile();
+                this->compiled.store(true, std::memory_order_release);
+            }
+        }
+        return this->compiledTemplate;
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::LazyTemplate::set(
+            std::shared_ptr<const BasicStringTemplate<T, Allocator>> compiledTemplate) noexcept {
+        this->compiledTemplate = std::move(compiledTemplate);
+        this->compiled.store(true, std::memory_order_release);
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::LazyTemplate::reset() noexcept {
+        this->compiled.store(false, std::memory_order_relaxed);
+        this->compiledTemplate.reset();
+    }
+
+    template<CharTypes T, typename Allocator>
+    const BasicStringTemplate<T, Allocator>& BasicStringInterpolation<T, Allocator>::getCompiledTemplate() const noexcept {
+        return *this->compiledTemplate.get([this]() {
+            return this->compileTemplate();
+        });
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::shared_ptr<const BasicStringTemplate<T, Allocator>>
+    BasicStringInterpolation<T, Allocator>::compileTemplate() const noexcept {
+        // templates on a caller supplied allocator live on it instead of in the process-wide cache
+        if constexpr (std::is_same_v<Allocator, std::allocator<T>>) {
+            return BasicStringTemplateCache<T>::getGlobal().get(this->getPattern(), this->getOpenDelimiter(),
+                                                                this->getCloseDelimiter());
+        } else {
+            return std::allocate_shared<BasicStringTemplate<T, Allocator>>(
+                    this->getAllocator(), this->getPattern(), this->getOpenDelimiter(), this->getCloseDelimiter(),
+                    this->getAllocator());
+        }
+    }
+
+    template<CharTypes T, typename Allocator>
+    bool BasicStringInterpolation<T, Allocator>::usesKeySubstitution() const noexcept {
+        return this->getOpenDelimiter().empty() || this->getCloseDelimiter().empty();
+    }
+
+    template<CharTypes T, typename Allocator>
+    bool BasicStringInterpolation<T, Allocator>::containsReplaceable(const String& replaceable) const noexcept {
+        if (this->usesKeySubstitution()) {
+            return this->getPattern().contains(replaceable);
+        }
+        return this->getCompiledTemplate().findPlaceholder(replaceable) != BasicStringTemplate<T, Allocator>::npos;
+    }
+
+    template<CharTypes T, typename Allocator>
+    std::shared_ptr<const BasicStringTemplate<T, Allocator>>
+    BasicStringInterpolation<T, Allocator>::getTemplate() const noexcept {
+        return this->compiledTemplate.get([this]() {
+            return this->compileTemplate();
+        });
+    }
+
+#if defined(STRING_INTERPOLATION_ENABLE_INSTRUMENTATION)
+    template<CharTypes T, typename Allocator>
+    const RenderCounters& BasicStringInterpolation<T, Allocator>::getRenderCounters() const noexcept {
+        return this->renderCounters;
+    }
+#endif
+
+    template<CharTypes T, typename Allocator>
+    typename BasicStringInterpolation<T, Allocator>::String
+    BasicStringInterpolation<T, Allocator>::validateReplaceable(const String& replaceable) const noexcept {
         if (replaceable.starts_with(this->getOpenDelimiter()) && replaceable.ends_with(this->getCloseDelimiter())) {
-            return replaceable;
+            return String(replaceable, this->getAllocator());
         }
-        return this->getOpenDelimiter() + replaceable + this->getCloseDelimiter();
+        // a joined template can contain placeholders with the delimiters of the other operand
+        if (!this->usesKeySubstitution() &&
+            this->getCompiledTemplate().findPlaceholder(replaceable) != BasicStringTemplate<T, Allocator>::npos) {
+            return String(replaceable, this->getAllocator());
+        }
+        String validReplaceable(this->getAllocator());
+        validReplaceable.reserve(this->getOpenDelimiter().length() + replaceable.length() +
+                                 this->getCloseDelimiter().length());
+        validReplaceable.append(this->getOpenDelimiter()).append(replaceable).append(this->getCloseDelimiter());
+        return validReplaceable;
     }
 
-    template<CharTypes T>
-    const std::basic_string<T>& BasicStringInterpolation<T>::getDefaultOpenDelimiter() noexcept {
+    template<CharTypes T, typename Allocator>
+    const typename BasicStringInterpolation<T, Allocator>::String&
+    BasicStringInterpolation<T, Allocator>::getDefaultOpenDelimiter() noexcept {
         return defaultOpenDelimiter;
     }
 
-    template<CharTypes T>
-    const std::basic_string<T>& BasicStringInterpolation<T>::getDefaultCloseDelimiter() noexcept {
+    template<CharTypes T, typename Allocator>
+    const typename BasicStringInterpolation<T, Allocator>::String&
+    BasicStringInterpolation<T, Allocator>::getDefaultCloseDelimiter() noexcept {
         return defaultCloseDelimiter;
     }
 
-    template<CharTypes T>
-    const std::basic_string<T>& BasicStringInterpolation<T>::getOpenDelimiter() const noexcept {
+    template<CharTypes T, typename Allocator>
+    const typename BasicStringInterpolation<T, Allocator>::String&
+    BasicStringInterpolation<T, Allocator>::getOpenDelimiter() const noexcept {
         return this->openDelimiter;
     }
 
-    template<CharTypes T>
-    void BasicStringInterpolation<T>::setOpenDelimiter(const std::basic_string<T>& openDelimiter) const noexcept {
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::setOpenDelimiter(const String& openDelimiter) const noexcept {
         this->openDelimiter = openDelimiter;
+        this->compiledTemplate.reset();
+        this->invalidateSubstitution();
     }
 
-    template<CharTypes T>
-    const std::basic_string<T>& BasicStringInterpolation<T>::getCloseDelimiter() const noexcept {
+    template<CharTypes T, typename Allocator>
+    const typename BasicStringInterpolation<T, Allocator>::String&
+    BasicStringInterpolation<T, Allocator>::getCloseDelimiter() const noexcept {
         return this->closeDelimiter;
     }
 
-    template<CharTypes T>
-    void BasicStringInterpolation<T>::setCloseDelimiter(
-            const std::basic_string<T>& closeDelimiter) const noexcept {
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::setCloseDelimiter(
+            const String& closeDelimiter) const noexcept {
         this->closeDelimiter = closeDelimiter;
+        this->compiledTemplate.reset();
+        this->invalidateSubstitution();
     }
 
-    template<CharTypes T>
-    const std::basic_string<T>& BasicStringInterpolation<T>::getPattern() const noexcept {
+    template<CharTypes T, typename Allocator>
+    const typename BasicStringInterpolation<T, Allocator>::String&
+    BasicStringInterpolation<T, Allocator>::getPattern() const noexcept {
         return this->pattern;
     }
 
-    template<CharTypes T>
-    void BasicStringInterpolation<T>::setPattern(
-            const std::basic_string<T>& pattern) noexcept {
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::setPattern(
+            const String& pattern) noexcept {
 
-        this->alreadySubstituted = false;
         this->pattern = pattern;
+        this->compiledTemplate.reset();
+        this->invalidateSubstitution();
     }
 
-    template<CharTypes T>
-    const std::map<std::basic_string<T>, std::basic_string<T>>&
-    BasicStringInterpolation<T>::getPatternArguments() const noexcept {
+    template<CharTypes T, typename Allocator>
+    const typename BasicStringInterpolation<T, Allocator>::Arguments&
+    BasicStringInterpolation<T, Allocator>::getPatternArguments() const noexcept {
         return this->patternArguments;
     }
 
-    template<CharTypes T>
-    void BasicStringInterpolation<T>::putPatternArguments(
-            const std::map<std::basic_string<T>, std::basic_string<T>>& patternArguments) const noexcept {
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::putPatternArguments(
+            const Arguments& patternArguments) const noexcept {
         for (const auto& [replaceable, replacement]: patternArguments){
             this->putPatternArgument(replaceable, replacement);
         }
     }
 
-    template<CharTypes T>
-    BasicStringInterpolation<T>::BasicStringInterpolation(
-            const std::basic_string<T>& pattern,
-            const std::map<std::basic_string<T>, std::basic_string<T>>& patternArguments) noexcept {
-        this->setPattern(pattern);
-        this->setOpenAndCloseDelimiters(defaultOpenDelimiter, defaultCloseDelimiter);
+    template<CharTypes T, typename Allocator>
+    BasicStringInterpolation<T, Allocator>::BasicStringInterpolation(
+            const String& pattern,
+            const Arguments& patternArguments,
+            const Allocator& allocator) noexcept :
+            BasicStringInterpolation(pattern, defaultOpenDelimiter, defaultCloseDelimiter,
+                                     SubstitutionPreparationModes::WITH_REPLACEMENT_VALIDATION, allocator) {
         this->putPatternArguments(patternArguments);
-        this->setSubstitutionPreparationMode(SubstitutionPreparationModes::WITH_REPLACEMENT_VALIDATION);
     }
 
-    template<CharTypes T>
-    BasicStringInterpolation<T>::BasicStringInterpolation(const std::basic_string<T>& pattern,
-                                                          const std::map<std::basic_string<T>, std::basic_string<T>>& patternArguments,
-                                                          const std::basic_string<T>& openDelimiter,
-                                                          const std::basic_string<T>& closeDelimiter) noexcept :
-                                                          openDelimiter(openDelimiter), closeDelimiter(closeDelimiter){
-        this->setPattern(pattern);
+    template<CharTypes T, typename Allocator>
+    BasicStringInterpolation<T, Allocator>::BasicStringInterpolation(const String& pattern,
+                                                                     const Arguments& patternArguments,
+                                                                     const String& openDelimiter,
+                                                                     const String& closeDelimiter,
+                                                                     const Allocator& allocator) noexcept :
+            BasicStringInterpolation(pattern, openDelimiter, closeDelimiter,
+                                     SubstitutionPreparationModes::WITH_REPLACEMENT_VALIDATION, allocator) {
         this->putPatternArguments(patternArguments);
-        this->setSubstitutionPreparationMode(SubstitutionPreparationModes::WITH_REPLACEMENT_VALIDATION);
     }
 
-    template<CharTypes T>
-    const std::basic_string<T> BasicStringInterpolation<T>::getSubstituted() const noexcept {
+    template<CharTypes T, typename Allocator>
+    const typename BasicStringInterpolation<T, Allocator>::String&
+    BasicStringInterpolation<T, Allocator>::getSubstituted() const noexcept {
+        this->evaluatePatternArgumentProviders();
+        return this->refreshSubstitution();
+    }
+
+    template<CharTypes T, typename Allocator>
+    const typename BasicStringInterpolation<T, Allocator>::String&
+    BasicStringInterpolation<T, Allocator>::refreshSubstitution() const noexcept {
         if (!this->alreadySubstituted) {
-            this->prepareSubstitution();
+            this->recordRender(this->substitution, 0, [this]() {
+                this->renderSubstitution();
+            });
+        } else if (this->hasDirtySlots) {
+            this->recordRender(this->substitution, 0, [this]() {
+                this->updateSubstitution();
+            });
+        } else {
+            this->recordCacheHit();
         }
         return this->substitution;
     }
 
-    template<CharTypes T>
-    void BasicStringInterpolation<T>::putPatternArgument(const std::basic_string<T>& replaceable,
-                                                         const std::basic_string<T>& replacement) const noexcept {
-        if (this->pattern.contains(this->validateReplaceable(replaceable))) {
-            this->patternArguments.emplace(this->validateReplaceable(replaceable), replacement);
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::appendSubstitutedTo(String& output) const noexcept {
+        this->evaluatePatternArgumentProviders();
+        if (this->alreadySubstituted || this->usesKeySubstitution()) {
+            output.append(this->refreshSubstitution());
+            return;
         }
+        this->validateSubstitution();
+        this->recordRender(output, output.length(), [this, &output]() {
+            this->getCompiledTemplate().renderTo(output, this->getPatternArguments());
+        });
     }
 
-    template<CharTypes T>
-    BasicStringInterpolation<T>::BasicStringInterpolation(const std::basic_string<T>& pattern) noexcept {
-        this->setPattern(pattern);
-        this->setOpenAndCloseDelimiters(defaultOpenDelimiter, defaultCloseDelimiter);
-        this->setSubstitutionPreparationMode(SubstitutionPreparationModes::WITH_REPLACEMENT_VALIDATION);
+    template<CharTypes T, typename Allocator>
+    typename BasicStringInterpolation<T, Allocator>::Fragments
+    BasicStringInterpolation<T, Allocator>::getSubstitutedFragments() const noexcept {
+        this->evaluatePatternArgumentProviders();
+        if (this->usesKeySubstitution()) {
+            Fragments fragments(this->getAllocator());
+            fragments.push_back(std::basic_string_view<T>(this->refreshSubstitution()));
+            return fragments;
+        }
+        this->validateSubstitution();
+        return this->getCompiledTemplate().renderFragments(this->getPatternArguments());
     }
 
-    template<CharTypes T>
-    [[maybe_unused]] void BasicStringInterpolation<T>::tryPrepareSubstitution() const noexcept(false) {
-        [[maybe_unused]] std::stringstream stringStream;
-        stringStream << "\n";
-        stringStream << "exception in file : " << __FILE__ << "\n"
-        << "inside function : " << __PRETTY_FUNCTION__ << "\n"
-        << "at line : " << __LINE__ << "\n";
-        try {
-            if (this->getPattern().empty()) {
-                stringStream << "exception message : "
-                << "it is impossible to build a string template, there is no template"
-                << "\n";
-                throw std::runtime_error(stringStream.str());
-            }
-            if (this->getPatternArguments().empty()) {
-                stringStream << "exception message : "
-                << "has no arguments to replace in pattern , cannot do substitution string"
-                << "\n";
-                throw std::runtime_error(stringStream.str());
-            }
-            for (const auto& [key, value]: this->getPatternArguments()) {
-                if (!this->getPattern().contains(key)) {
-                    stringStream << "exception message : "
-                    << "the string template's pattern \" " +
-                    static_cast<std::basic_string<T>>(this->getPattern()) +
-                    " \" does not contain a argument " +
-                    static_cast<std::basic_string<T>>(key) + "."
-                    << "\n";
-                    throw std::runtime_error(stringStream.str());
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::putPatternArgument(const String& replaceable,
+                                                         const String& replacement) const noexcept {
+        const String validReplaceable = this->validateReplaceable(replaceable);
+        this->patternArgumentProviders.erase(validReplaceable);
+        this->storePatternArgument(validReplaceable, replacement);
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::putPatternArgumentProvider(const String& replaceable,
+                                                                            ArgumentProvider provider,
+                                                                            ArgumentProviderModes mode) const noexcept {
+        this->patternArgumentProviders.insert_or_assign(this->validateReplaceable(replaceable),
+                                                        PatternArgumentProvider{std::move(provider), mode});
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::evaluatePatternArgumentProviders() const noexcept {
+        for (auto& [replaceable, provider]: this->patternArgumentProviders) {
+            if ((provider.mode == ArgumentProviderModes::EVALUATE_ONCE && provider.evaluated) ||
+                !this->containsReplaceable(replaceable)) {
+                continue;
+            }
+            this->storePatternArgument(replaceable, provider.provider());
+            provider.evaluated = true;
+        }
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::storePatternArgument(const String& validReplaceable,
+                                                                      const String& replacement) const noexcept {
+        // an argument is kept whenever the pattern contains its replaceable, as before the pattern was compiled,
+        // a placeholder of the template is found without scanning the pattern
+        const bool rawSubstitution = this->usesKeySubstitution();
+        const std::size_t slot = rawSubstitution ? BasicStringTemplate<T, Allocator>::npos :
+                                 this->getCompiledTemplate().findPlaceholder(validReplaceable);
+        if (slot == BasicStringTemplate<T, Allocator>::npos && !this->getPattern().contains(validReplaceable)) {
+            return;
+        }
+        const auto [argument, inserted] = this->patternArguments.try_emplace(validReplaceable, replacement);
+        if (!inserted) {
+            if (argument->second == replacement) {
+                return;
+            }
+            argument->second = replacement;
+        }
+        // the automaton depends on the keys only, a new value is replaced in it unless a copy shares it
+        if (inserted || this->keySubstitution.use_count() != 1 ||
+            !this->keySubstitution->setReplacement(validReplaceable, replacement)) {
+            this->keySubstitution.reset();
+        }
+        // a new key can change the missing and unused arguments, a new value of an existing key cannot
+        if (inserted) {
+            this->alreadyValidated = false;
+        }
+        if (rawSubstitution) {
+            this->alreadySubstituted = false;
+            return;
+        }
+        if (this->alreadySubstituted && slot != BasicStringTemplate<T, Allocator>::npos) {
+            this->dirtySlots[slot] = true;
+            this->hasDirtySlots = true;
+        }
+    }
+
+    template<CharTypes T, typename Allocator>
+    BasicStringInterpolation<T, Allocator>::BasicStringInterpolation(const String& pattern, const Allocator& allocator) noexcept :
+            BasicStringInterpolation(pattern, defaultOpenDelimiter, defaultCloseDelimiter,
+                                     SubstitutionPreparationModes::WITH_REPLACEMENT_VALIDATION, allocator) {
+    }
+
+    template<CharTypes T, typename Allocator>
+    const BasicValidationReport<T, Allocator>& BasicStringInterpolation<T, Allocator>::getValidationReport() const noexcept {
+        if (this->alreadyValidated) {
+            return this->validationReport;
+        }
+        BasicValidationReport<T, Allocator>& report = this->validationReport;
+        report.clear();
+        if (this->getPattern().empty()) {
+            report.addError(ValidationErrors::EMPTY_PATTERN);
+        }
+        if (this->getPatternArguments().empty()) {
+            report.addError(ValidationErrors::NO_ARGUMENTS);
+        }
+        const bool rawSubstitution = this->usesKeySubstitution();
+        if (!rawSubstitution) {
+            const BasicStringTemplate<T, Allocator>& compiledTemplate = this->getCompiledTemplate();
+            const auto& placeholders = compiledTemplate.getPlaceholders();
+            for (std::size_t slot = 0; slot < placeholders.size(); ++slot) {
+                if (!this->patternArguments.contains(placeholders[slot].replaceable)) {
+                    report.addError(ValidationErrors::MISSING_ARGUMENTS);
+                    report.setBit(report.missingPlaceholders, placeholders.size(), slot);
                 }
             }
-        } catch (std::exception const& substitutionPrepareException) {
-            std::cerr << substitutionPrepareException.what();
-        } catch (...) {
-            std::cerr << stringStream.str();
+            if (!compiledTemplate.getUnterminatedPlaceholders().empty()) {
+                report.addError(ValidationErrors::UNTERMINATED_PLACEHOLDERS);
+            }
+        }
+        std::size_t index = 0;
+        for (const auto& [replaceable, replacement]: this->getPatternArguments()) {
+            if (!this->containsReplaceable(replaceable)) {
+                report.addError(ValidationErrors::UNUSED_ARGUMENTS);
+                report.setBit(report.unusedArguments, this->patternArguments.size(), index);
+            }
+            ++index;
         }
+        this->alreadyValidated = true;
+        return report;
     }
 
-    template<CharTypes T>
-    BasicStringInterpolation<T>&
-    BasicStringInterpolation<T>::operator+=(const BasicStringInterpolation<T>& templateBasicString) noexcept {
+    template<CharTypes T, typename Allocator>
+    std::expected<void, ValidationErrors> BasicStringInterpolation<T, Allocator>::validate() const noexcept {
+        return this->getValidationReport().getResult();
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::setValidationCallback(ValidationCallback validationCallback) const noexcept {
+        this->validationCallback = std::move(validationCallback);
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::validateSubstitution() const noexcept {
+        if (this->getSubstitutionPreparationMode() != SubstitutionPreparationModes::WITH_REPLACEMENT_VALIDATION ||
+            this->alreadyValidated) {
+            return;
+        }
+        const BasicValidationReport<T, Allocator>& report = this->getValidationReport();
+        if (!report.isValid() && this->validationCallback) {
+            this->validationCallback(report);
+        }
+    }
+
+    template<CharTypes T, typename Allocator>
+    BasicStringInterpolation<T, Allocator>&
+    BasicStringInterpolation<T, Allocator>::operator+=(const BasicStringInterpolation<T, Allocator>& templateBasicString) noexcept {
+        const bool rawSubstitution = this->usesKeySubstitution() || templateBasicString.usesKeySubstitution();
+        std::shared_ptr<const BasicStringTemplate<T, Allocator>> joinedTemplate;
+        if (!rawSubstitution) {
+            const std::array<std::shared_ptr<const BasicStringTemplate<T, Allocator>>, 2> parts{
+                    this->getTemplate(), templateBasicString.getTemplate()};
+            joinedTemplate = std::allocate_shared<BasicStringTemplate<T, Allocator>>(
+                    this->getAllocator(), std::span<const std::shared_ptr<const BasicStringTemplate<T, Allocator>>>(parts),
+                    this->getAllocator());
+        }
         this->pattern += templateBasicString.getPattern();
+        if (joinedTemplate) {
+            this->compiledTemplate.set(std::move(joinedTemplate));
+        } else {
+            this->compiledTemplate.reset();
+        }
+        this->invalidateSubstitution();
         this->putPatternArguments(templateBasicString.getPatternArguments());
+        for (const auto& [replaceable, provider]: templateBasicString.patternArgumentProviders) {
+            this->putPatternArgumentProvider(replaceable, provider.provider, provider.mode);
+        }
         return *this;
     }
 
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::setOpenAndCloseDelimiters(const String& openDelimiter,
+                                                                const String& closeDelimiter) const noexcept {
+        this->openDelimiter = openDelimiter;
+        this->closeDelimiter = closeDelimiter;
+        this->compiledTemplate.reset();
+        this->invalidateSubstitution();
+    }
+
+    template<CharTypes T, typename Allocator>
+    BasicStringInterpolation<T, Allocator>::BasicStringInterpolation() noexcept : BasicStringInterpolation(Allocator()) {
+    }
+
+    template<CharTypes T, typename Allocator>
+    BasicStringInterpolation<T, Allocator>::BasicStringInterpolation(const Allocator& allocator) noexcept :
+            BasicStringInterpolation(String(allocator), defaultOpenDelimiter, defaultCloseDelimiter,
+                                     SubstitutionPreparationModes::WITH_REPLACEMENT_VALIDATION, allocator) {
+    }
+
+    template<CharTypes T, typename Allocator>
+    Allocator BasicStringInterpolation<T, Allocator>::getAllocator() const noexcept {
+        return this->pattern.get_allocator();
+    }
+
+    template<CharTypes T, typename Allocator>
+    BasicStringInterpolation<T, Allocator>::BasicStringInterpolation(const String& pattern,
+                                                                     const String& openDelimiter,
+                                                                     const String& closeDelimiter,
+                                                                     const Allocator& allocator) noexcept :
+            BasicStringInterpolation(pattern, openDelimiter, closeDelimiter,
+                                     SubstitutionPreparationModes::WITH_REPLACEMENT_VALIDATION, allocator) {
+    }
+
+    template<CharTypes T, typename Allocator>
+    SubstitutionPreparationModes BasicStringInterpolation<T, Allocator>::getSubstitutionPreparationMode() const noexcept {
+        return this->substitutionPreparationMode;
+    }
+
+    template<CharTypes T, typename Allocator>
+    void BasicStringInterpolation<T, Allocator>::setSubstitutionPreparationMode(const SubstitutionPreparationModes substitutionPreparationMode) const noexcept {
+        this->substitutionPreparationMode = substitutionPreparationMode;
+    }
+
+    template<CharTypes T, typename Allocator>
+    BasicStringInterpolation<T, Allocator>::BasicStringInterpolation(SubstitutionPreparationModes substitutionPreparationMode,
+                                                                     const Allocator& allocator) noexcept :
+            BasicStringInterpolation(String(allocator), defaultOpenDelimiter, defaultCloseDelimiter,
+                                     substitutionPreparationMode, allocator) {
+    }
+
+    template<CharTypes T, typename Allocator>
+    BasicStringInterpolation<T, Allocator>::BasicStringInterpolation(const String& pattern,
+                                                                     const Arguments& patternArguments,
+                                                                     const String& openDelimiter,
+                                                                     const String& closeDelimiter,
+                                                                     SubstitutionPreparationModes substitutionPreparationMode,
+                                                                     const Allocator& allocator) noexcept :
+            BasicStringInterpolation(pattern, openDelimiter, closeDelimiter, substitutionPreparationMode, allocator) {
+        this->putPatternArguments(patternArguments);
+    }
+
+    template<CharTypes T, typename Allocator>
+    BasicStringInterpolation<T, Allocator>::BasicStringInterpolation(const String& pattern,
+                                                                     const Arguments& patternArguments,
+                                                                     SubstitutionPreparationModes substitutionPreparationMode,
+                                                                     const Allocator& allocator) noexcept :
+            BasicStringInterpolation(pattern, defaultOpenDelimiter, defaultCloseDelimiter, substitutionPreparationMode,
+                                     allocator) {
+        this->putPatternArguments(patternArguments);
+    }
+
+    template<CharTypes T, typename Allocator>
+    BasicStringInterpolation<T, Allocator>::BasicStringInterpolation(const String& pattern,
+                                                                     SubstitutionPreparationModes substitutionPreparationMode,
+                                                                     const Allocator& allocator) noexcept :
+            BasicStringInterpolation(pattern, defaultOpenDelimiter, defaultCloseDelimiter, substitutionPreparationMode,
+                                     allocator) {
+    }
+
+    template<CharTypes T, typename Allocator>
+    BasicStringInterpolation<T, Allocator>::BasicStringInterpolation(const String& pattern,
+                                                                     const String& openDelimiter,
+                                                                     const String& closeDelimiter,
+                                                                     SubstitutionPreparationModes substitutionPreparationMode,
+                                                                     const Allocator& allocator) noexcept :
+            pattern(pattern, allocator), substitution(allocator), patternArguments(allocator),
+            patternArgumentProviders(allocator), openDelimiter(openDelimiter, allocator),
+            closeDelimiter(closeDelimiter, allocator), substitutionPreparationMode(substitutionPreparationMode),
+            validationReport(allocator), segmentOffsets(allocator), dirtySlots(allocator) {
+    }
+
+    template<CharTypes T>
+    class BasicStreamSubstitution {
+    public:
+        static constexpr std::size_t defaultChunkSize = 64 * 1024;
+
+        explicit BasicStreamSubstitution(const std::map<std::basic_string<T>, std::basic_string<T>>& patternArguments,
+                                         std::size_t chunkSize = defaultChunkSize) noexcept;
+
+        BasicStreamSubstitution(const std::map<std::basic_string<T>, std::basic_string<T>>& patternArguments,
+                                const std::basic_string<T>& openDelimiter,
+                                const std::basic_string<T>& closeDelimiter,
+                                std::size_t chunkSize = defaultChunkSize) noexcept;
+
+        std::size_t getChunkSize() const noexcept;
+
+        std::size_t getMaxPlaceholderLength() const noexcept;
+
+        template<std::invocable<std::basic_string_view<T>> Sink>
+        void feed(std::basic_string_view<T> chunk, Sink&& sink) noexcept;
+
+        template<std::invocable<std::basic_string_view<T>> Sink>
+        void finish(Sink&& sink) noexcept;
+
+        template<std::invocable<std::basic_string_view<T>> Sink>
+        void substitute(std::basic_string_view<T> region, Sink&& sink) noexcept;
+
+        template<std::invocable<std::basic_string_view<T>> Sink>
+        void substitute(std::basic_istream<T>& input, Sink&& sink) noexcept;
+
+        void substitute(std::basic_istream<T>& input, std::basic_ostream<T>& output) noexcept;
+
+#if __has_include(<unistd.h>)
+        template<std::invocable<std::basic_string_view<T>> Sink>
+        bool substitute(int fileDescriptor, Sink&& sink) noexcept requires std::is_same_v<T, char>;
+#endif
+
+    private:
+        template<typename Sink>
+        std::size_t substituteAvailable(std::basic_string_view<T> text, bool last, Sink&& sink) noexcept;
+
+        std::map<std::basic_string<T>, std::basic_string<T>, std::less<>> patternArguments;
+        std::basic_string<T> openDelimiter, closeDelimiter;
+        std::size_t chunkSize;
+        std::size_t maxPlaceholderLength = 0;
+        std::basic_string<T> carry;
+        bool insideUnknownPlaceholder = false;
+        // with the same open and close delimiter, whether the name of the unknown placeholder was not a name
+        bool unknownPlaceholderHasWhitespace = false;
+        std::size_t closeSearchStart = 0;
+    };
+
     template<CharTypes T>
-    void BasicStringInterpolation<T>::setOpenAndCloseDelimiters(const std::basic_string<T>& openDelimiter,
-                                                                const std::basic_string<T>& closeDelimiter) const noexcept {
-        this->setOpenDelimiter(openDelimiter);
-        this->setCloseDelimiter(closeDelimiter);
+    BasicStreamSubstitution<T>::BasicStreamSubstitution(
+            const std::map<std::basic_string<T>, std::basic_string<T>>& patternArguments,
+            std::size_t chunkSize) noexcept :
+            BasicStreamSubstitution(patternArguments,
+                                    BasicStringInterpolation<T>::getDefaultOpenDelimiter(),
+                                    BasicStringInterpolation<T>::getDefaultCloseDelimiter(),
+                                    chunkSize) {
     }
 
     template<CharTypes T>
-    BasicStringInterpolation<T>::BasicStringInterpolation() noexcept {
-        this->setOpenAndCloseDelimiters(defaultOpenDelimiter, defaultCloseDelimiter);
-        this->setSubstitutionPreparationMode(SubstitutionPreparationModes::WITH_REPLACEMENT_VALIDATION);
+    BasicStreamSubstitution<T>::BasicStreamSubstitution(
+            const std::map<std::basic_string<T>, std::basic_string<T>>& patternArguments,
+            const std::basic_string<T>& openDelimiter,
+            const std::basic_string<T>& closeDelimiter,
+            std::size_t chunkSize) noexcept :
+            openDelimiter(openDelimiter), closeDelimiter(closeDelimiter), chunkSize(std::max<std::size_t>(chunkSize, 1)) {
+        for (const auto& [replaceable, replacement]: patternArguments) {
+            const std::basic_string<T>& delimited =
+                    replaceable.starts_with(openDelimiter) && replaceable.ends_with(closeDelimiter)
+                    ? replaceable
+                    : openDelimiter + replaceable + closeDelimiter;
+            this->maxPlaceholderLength = std::max(this->maxPlaceholderLength, delimited.length());
+            this->patternArguments.emplace(delimited, replacement);
+        }
     }
 
     template<CharTypes T>
-    BasicStringInterpolation<T>::BasicStringInterpolation(const std::basic_string<T>& pattern,
-                                                          const std::basic_string<T>& openDelimiter,
-                                                          const std::basic_string<T>& closeDelimiter) noexcept :
-                                                          openDelimiter(openDelimiter), closeDelimiter(closeDelimiter) {
-        this->setPattern(pattern);
-        this->setSubstitutionPreparationMode(SubstitutionPreparationModes::WITH_REPLACEMENT_VALIDATION);
+    std::size_t BasicStreamSubstitution<T>::getChunkSize() const noexcept {
+        return this->chunkSize;
     }
 
     template<CharTypes T>
-    SubstitutionPreparationModes BasicStringInterpolation<T>::getSubstitutionPreparationMode() const noexcept {
-        return this->substitutionPreparationMode;
+    std::size_t BasicStreamSubstitution<T>::getMaxPlaceholderLength() const noexcept {
+        return this->maxPlaceholderLength;
     }
 
+    // substitutes every placeholder of text and returns how much of it was consumed,
+    // unless this is the last part of the input, a tail that may still turn into a
+    // placeholder once more input arrives is left unconsumed. A placeholder longer than
+    // every argument is copied through without being buffered up to its close delimiter
     template<CharTypes T>
-    void BasicStringInterpolation<T>::setSubstitutionPreparationMode(const SubstitutionPreparationModes substitutionPreparationMode) const noexcept {
-        this->substitutionPreparationMode = substitutionPreparationMode;
+    template<typename Sink>
+    std::size_t BasicStreamSubstitution<T>::substituteAvailable(std::basic_string_view<T> text, bool last,
+                                                                Sink&& sink) noexcept {
+        const std::size_t openLength = this->openDelimiter.length();
+        const std::size_t closeLength = this->closeDelimiter.length();
+        const auto emit = [&sink](std::basic_string_view<T> fragment) {
+            if (!fragment.empty()) {
+                sink(fragment);
+            }
+        };
+        if (openLength == 0 || closeLength == 0 || this->patternArguments.empty()) {
+            emit(text);
+            return text.length();
+        }
+        // the pairing of BasicStringTemplate, with the same open and close delimiter a name that is empty
+        // or contains whitespace is literal text and its close delimiter is tried as the next open delimiter
+        const bool sameDelimiters = this->openDelimiter == this->closeDelimiter;
+        const auto hasWhitespace = [](std::basic_string_view<T> name) {
+            return std::ranges::any_of(name, [](T character) {
+                return character == static_cast<T>(' ') || character == static_cast<T>('\t') ||
+                       character == static_cast<T>('\n') || character == static_cast<T>('\r');
+            });
+        };
+
+        std::size_t literalStart = 0;
+        std::size_t position = 0;
+        while (true) {
+            std::size_t open = std::basic_string_view<T>::npos;
+            std::size_t closeSearchStart = this->closeSearchStart;
+            if (!this->insideUnknownPlaceholder) {
+                open = BasicDelimiterScanner<T>::find(text, this->openDelimiter, position);
+                if (open == std::basic_string_view<T>::npos) {
+                    const std::size_t kept = last ? 0 : std::min(openLength - 1,
+                                                                 text.length() - std::max(literalStart, position));
+                    emit(text.substr(literalStart, text.length() - kept - literalStart));
+                    return text.length() - kept;
+                }
+                closeSearchStart = open + openLength;
+            }
+            const std::size_t close = BasicDelimiterScanner<T>::find(text, this->closeDelimiter, closeSearchStart);
+            if (close == std::basic_string_view<T>::npos) {
+                if (last) {
+                    emit(text.substr(literalStart));
+                    return text.length();
+                }
+                if (!this->insideUnknownPlaceholder && text.length() - open <= this->maxPlaceholderLength) {
+                    emit(text.substr(literalStart, open - literalStart));
+                    return open;
+                }
+                // only the last maxPlaceholderLength characters can still begin a known placeholder
+                const std::size_t consumed = text.length() > this->maxPlaceholderLength
+                                             ? text.length() - this->maxPlaceholderLength
+                                             : 0;
+                emit(text.substr(literalStart, consumed - std::min(consumed, literalStart)));
+                if (sameDelimiters) {
+                    const std::size_t nameStart = this->insideUnknownPlaceholder ? 0 : open + openLength;
+                    this->unknownPlaceholderHasWhitespace =
+                            (this->insideUnknownPlaceholder && this->unknownPlaceholderHasWhitespace) ||
+                            (consumed > nameStart && hasWhitespace(text.substr(nameStart, consumed - nameStart)));
+                }
+                this->insideUnknownPlaceholder = true;
+                this->closeSearchStart = std::max(closeSearchStart, consumed) - consumed;
+                return consumed;
+            }
+            if (sameDelimiters) {
+                const std::size_t nameStart = this->insideUnknownPlaceholder ? 0 : open + openLength;
+                const std::basic_string_view<T> name = text.substr(nameStart, close - nameStart);
+                const bool isName = this->insideUnknownPlaceholder
+                                    ? !this->unknownPlaceholderHasWhitespace && !hasWhitespace(name)
+                                    : !name.empty() && !hasWhitespace(name);
+                if (!isName) {
+                    this->insideUnknownPlaceholder = false;
+                    this->closeSearchStart = 0;
+                    position = close;
+                    continue;
+                }
+            }
+            const std::size_t innermostOpen = sameDelimiters
+                                              ? (this->insideUnknownPlaceholder ? std::basic_string_view<T>::npos : open)
+                                              : close >= openLength
+                                                ? text.rfind(this->openDelimiter, close - openLength)
+                                                : std::basic_string_view<T>::npos;
+            if (innermostOpen != std::basic_string_view<T>::npos &&
+                (this->insideUnknownPlaceholder || innermostOpen >= open)) {
+                open = innermostOpen;
+                const std::size_t end = close + closeLength;
+                const auto replacement = this->patternArguments.find(text.substr(open, end - open));
+                if (replacement != this->patternArguments.end()) {
+                    emit(text.substr(literalStart, open - literalStart));
+                    emit(replacement->second);
+                    literalStart = end;
+                }
+            }
+            this->insideUnknownPlaceholder = false;
+            this->closeSearchStart = 0;
+            position = close + closeLength;
+        }
     }
 
     template<CharTypes T>
-    BasicStringInterpolation<T>::BasicStringInterpolation(SubstitutionPreparationModes substitutionPreparationMode) noexcept {
-        this->setOpenAndCloseDelimiters(defaultOpenDelimiter, defaultCloseDelimiter);
-        this->setSubstitutionPreparationMode(substitutionPreparationMode);
+    template<std::invocable<std::basic_string_view<T>> Sink>
+    void BasicStreamSubstitution<T>::feed(std::basic_string_view<T> chunk, Sink&& sink) noexcept {
+        if (this->carry.empty()) {
+            const std::size_t consumed = this->substituteAvailable(chunk, false, sink);
+            this->carry.assign(chunk.substr(consumed));
+            return;
+        }
+        this->carry.append(chunk);
+        const std::size_t consumed = this->substituteAvailable(this->carry, false, sink);
+        this->carry.erase(0, consumed);
     }
 
     template<CharTypes T>
-    BasicStringInterpolation<T>::BasicStringInterpolation(const std::basic_string<T>& pattern,
-                                                          const std::map<std::basic_string<T>, std::basic_string<T>>& patternArguments,
-                                                          const std::basic_string<T>& openDelimiter,
-                                                          const std::basic_string<T>& closeDelimiter, SubstitutionPreparationModes substitutionPreparationMode) noexcept :
-                                                          openDelimiter(openDelimiter), closeDelimiter(closeDelimiter) {
-        this->setPattern(pattern);
-        this->putPatternArguments(patternArguments);
-        this->setSubstitutionPreparationMode(substitutionPreparationMode);
+    template<std::invocable<std::basic_string_view<T>> Sink>
+    void BasicStreamSubstitution<T>::finish(Sink&& sink) noexcept {
+        this->substituteAvailable(this->carry, true, sink);
+        this->carry.clear();
+        this->insideUnknownPlaceholder = false;
+        this->unknownPlaceholderHasWhitespace = false;
+        this->closeSearchStart = 0;
     }
 
     template<CharTypes T>
-    BasicStringInterpolation<T>::BasicStringInterpolation(const std::basic_string<T>& pattern,
-                                                          const std::map<std::basic_string<T>, std::basic_string<T>>& patternArguments,
-                                                          SubstitutionPreparationModes substitutionPreparationMode) noexcept {
-        this->setPattern(pattern);
-        this->setOpenAndCloseDelimiters(defaultOpenDelimiter, defaultCloseDelimiter);
-        this->putPatternArguments(patternArguments);
-        this->setSubstitutionPreparationMode(substitutionPreparationMode);
+    template<std::invocable<std::basic_string_view<T>> Sink>
+    void BasicStreamSubstitution<T>::substitute(std::basic_string_view<T> region, Sink&& sink) noexcept {
+        this->feed(region, sink);
+        this->finish(sink);
     }
 
     template<CharTypes T>
-    BasicStringInterpolation<T>::BasicStringInterpolation(const std::basic_string<T>& pattern, SubstitutionPreparationModes substitutionPreparationMode) noexcept {
-        this->setPattern(pattern);
-        this->setOpenAndCloseDelimiters(defaultOpenDelimiter, defaultCloseDelimiter);
-        this->setSubstitutionPreparationMode(substitutionPreparationMode);
+    template<std::invocable<std::basic_string_view<T>> Sink>
+    void BasicStreamSubstitution<T>::substitute(std::basic_istream<T>& input, Sink&& sink) noexcept {
+        std::basic_string<T> chunk(this->chunkSize, T());
+        while (input.read(chunk.data(), static_cast<std::streamsize>(chunk.length())) || input.gcount() > 0) {
+            this->feed(std::basic_string_view<T>(chunk.data(), static_cast<std::size_t>(input.gcount())), sink);
+        }
+        this->finish(sink);
+    }
+
+    template<CharTypes T>
+    void BasicStreamSubstitution<T>::substitute(std::basic_istream<T>& input, std::basic_ostream<T>& output) noexcept {
+        this->substitute(input, [&output](std::basic_string_view<T> fragment) {
+            output.write(fragment.data(), static_cast<std::streamsize>(fragment.length()));
+        });
     }
 
+#if __has_include(<unistd.h>)
     template<CharTypes T>
-    BasicStringInterpolation<T>::BasicStringInterpolation(const std::basic_string<T>& pattern,
-                                                          const std::basic_string<T>& openDelimiter,
-                                                          const std::basic_string<T>& closeDelimiter, SubstitutionPreparationModes substitutionPreparationMode) noexcept :
-                                                          openDelimiter(openDelimiter), closeDelimiter(closeDelimiter) {
-        this->setPattern(pattern);
-        this->setSubstitutionPreparationMode(substitutionPreparationMode);
+    template<std::invocable<std::basic_string_view<T>> Sink>
+    bool BasicStreamSubstitution<T>::substitute(int fileDescriptor, Sink&& sink) noexcept
+    requires std::is_same_v<T, char> {
+        std::basic_string<T> chunk(this->chunkSize, T());
+        while (true) {
+            const ::ssize_t count = ::read(fileDescriptor, chunk.data(), chunk.length());
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+            if (count < 0) {
+                return false;
+            }
+            if (count == 0) {
+                break;
+            }
+            this->feed(std::basic_string_view<T>(chunk.data(), static_cast<std::size_t>(count)), sink);
+        }
+        this->finish(sink);
+        return true;
+    }
+#endif
+
+    template<CharTypes T, typename Allocator>
+    BasicStringTemplate<T, Allocator>::BasicStringTemplate(const String& pattern, const Allocator& allocator) noexcept :
+            BasicStringTemplate(pattern,
+                                BasicStringInterpolation<T, Allocator>::getDefaultOpenDelimiter(),
+                                BasicStringInterpolation<T, Allocator>::getDefaultCloseDelimiter(),
+                                allocator) {
     }
 
+    using StringTemplate [[maybe_unused]] = BasicStringTemplate<char>;
+    using RenderedBatch [[maybe_unused]] = BasicRenderedBatch<char>;
+    using StringTemplateCache [[maybe_unused]] = BasicStringTemplateCache<char>;
+    using StreamSubstitution [[maybe_unused]] = BasicStreamSubstitution<char>;
+    using KeySubstitution [[maybe_unused]] = BasicKeySubstitution<char>;
+    using ValidationReport [[maybe_unused]] = BasicValidationReport<char>;
+#if defined(STRING_INTERPOLATION_ENABLE_INSTRUMENTATION)
+    using RenderEvent [[maybe_unused]] = BasicRenderEvent<char>;
+    using RenderHooks [[maybe_unused]] = BasicRenderHooks<char>;
+#endif
+    using TemplateBundleWriter [[maybe_unused]] = BasicTemplateBundleWriter<char>;
+    using TemplateBundle [[maybe_unused]] = BasicTemplateBundle<char>;
+    using TemplateView [[maybe_unused]] = BasicTemplateView<char>;
     using StringInterpolation [[maybe_unused]] = BasicStringInterpolation<char>;
 #if defined(STRING_INTERPOLATION_EXTEND_TYPES)
+    using StringTemplateU8 [[maybe_unused]] = BasicStringTemplate<char8_t>;
+    using StringTemplateU16 [[maybe_unused]] = BasicStringTemplate<char16_t>;
+    using StringTemplateU32 [[maybe_unused]] = BasicStringTemplate<char32_t>;
+    using StringTemplateW [[maybe_unused]] = BasicStringTemplate<wchar_t>;
+    using RenderedBatchU8 [[maybe_unused]] = BasicRenderedBatch<char8_t>;
+    using RenderedBatchU16 [[maybe_unused]] = BasicRenderedBatch<char16_t>;
+    using RenderedBatchU32 [[maybe_unused]] = BasicRenderedBatch<char32_t>;
+    using RenderedBatchW [[maybe_unused]] = BasicRenderedBatch<wchar_t>;
+    using StringTemplateCacheU8 [[maybe_unused]] = BasicStringTemplateCache<char8_t>;
+    using StringTemplateCacheU16 [[maybe_unused]] = BasicStringTemplateCache<char16_t>;
+    using StringTemplateCacheU32 [[maybe_unused]] = BasicStringTemplateCache<char32_t>;
+    using StringTemplateCacheW [[maybe_unused]] = BasicStringTemplateCache<wchar_t>;
+    using StreamSubstitutionU8 [[maybe_unused]] = BasicStreamSubstitution<char8_t>;
+    using StreamSubstitutionU16 [[maybe_unused]] = BasicStreamSubstitution<char16_t>;
+    using StreamSubstitutionU32 [[maybe_unused]] = BasicStreamSubstitution<char32_t>;
+    using StreamSubstitutionW [[maybe_unused]] = BasicStreamSubstitution<wchar_t>;
+    using KeySubstitutionU8 [[maybe_unused]] = BasicKeySubstitution<char8_t>;
+    using KeySubstitutionU16 [[maybe_unused]] = BasicKeySubstitution<char16_t>;
+    using KeySubstitutionU32 [[maybe_unused]] = BasicKeySubstitution<char32_t>;
+    using KeySubstitutionW [[maybe_unused]] = BasicKeySubstitution<wchar_t>;
+    using ValidationReportU8 [[maybe_unused]] = BasicValidationReport<char8_t>;
+    using ValidationReportU16 [[maybe_unused]] = BasicValidationReport<char16_t>;
+    using ValidationReportU32 [[maybe_unused]] = BasicValidationReport<char32_t>;
+    using ValidationReportW [[maybe_unused]] = BasicValidationReport<wchar_t>;
+#if defined(STRING_INTERPOLATION_ENABLE_INSTRUMENTATION)
+    using RenderEventU8 [[maybe_unused]] = BasicRenderEvent<char8_t>;
+    using RenderEventU16 [[maybe_unused]] = BasicRenderEvent<char16_t>;
+    using RenderEventU32 [[maybe_unused]] = BasicRenderEvent<char32_t>;
+    using RenderEventW [[maybe_unused]] = BasicRenderEvent<wchar_t>;
+    using RenderHooksU8 [[maybe_unused]] = BasicRenderHooks<char8_t>;
+    using RenderHooksU16 [[maybe_unused]] = BasicRenderHooks<char16_t>;
+    using RenderHooksU32 [[maybe_unused]] = BasicRenderHooks<char32_t>;
+    using RenderHooksW [[maybe_unused]] = BasicRenderHooks<wchar_t>;
+#endif
+    using TemplateBundleWriterU8 [[maybe_unused]] = BasicTemplateBundleWriter<char8_t>;
+    using TemplateBundleWriterU16 [[maybe_unused]] = BasicTemplateBundleWriter<char16_t>;
+    using TemplateBundleWriterU32 [[maybe_unused]] = BasicTemplateBundleWriter<char32_t>;
+    using TemplateBundleWriterW [[maybe_unused]] = BasicTemplateBundleWriter<wchar_t>;
+    using TemplateBundleU8 [[maybe_unused]] = BasicTemplateBundle<char8_t>;
+    using TemplateBundleU16 [[maybe_unused]] = BasicTemplateBundle<char16_t>;
+    using TemplateBundleU32 [[maybe_unused]] = BasicTemplateBundle<char32_t>;
+    using TemplateBundleW [[maybe_unused]] = BasicTemplateBundle<wchar_t>;
+    using TemplateViewU8 [[maybe_unused]] = BasicTemplateView<char8_t>;
+    using TemplateViewU16 [[maybe_unused]] = BasicTemplateView<char16_t>;
+    using TemplateViewU32 [[maybe_unused]] = BasicTemplateView<char32_t>;
+    using TemplateViewW [[maybe_unused]] = BasicTemplateView<wchar_t>;
     using StringInterpolationU8 [[maybe_unused]] = BasicStringInterpolation<char8_t>;
     using StringInterpolationU16 [[maybe_unused]] = BasicStringInterpolation<char16_t>;
     using StringInterpolationU32 [[maybe_unused]] = BasicStringInterpolation<char32_t>;
     using StringInterpolationW [[maybe_unused]] = BasicStringInterpolation<wchar_t>;
 #endif
 
+    namespace pmr {
+        using StringTemplate [[maybe_unused]] = BasicStringTemplate<char, std::pmr::polymorphic_allocator<char>>;
+        using RenderedBatch [[maybe_unused]] = BasicRenderedBatch<char, std::pmr::polymorphic_allocator<char>>;
+        using KeySubstitution [[maybe_unused]] = BasicKeySubstitution<char, std::pmr::polymorphic_allocator<char>>;
+        using ValidationReport [[maybe_unused]] = BasicValidationReport<char, std::pmr::polymorphic_allocator<char>>;
+        using TemplateBundleWriter [[maybe_unused]] =
+                BasicTemplateBundleWriter<char, std::pmr::polymorphic_allocator<char>>;
+        using TemplateBundle [[maybe_unused]] = BasicTemplateBundle<char, std::pmr::polymorphic_allocator<char>>;
+        using TemplateView [[maybe_unused]] = BasicTemplateView<char, std::pmr::polymorphic_allocator<char>>;
+        using StringInterpolation [[maybe_unused]] =
+                BasicStringInterpolation<char, std::pmr::polymorphic_allocator<char>>;
+#if defined(STRING_INTERPOLATION_EXTEND_TYPES)
+        using StringTemplateU8 [[maybe_unused]] =
+                BasicStringTemplate<char8_t, std::pmr::polymorphic_allocator<char8_t>>;
+        using StringTemplateU16 [[maybe_unused]] =
+                BasicStringTemplate<char16_t, std::pmr::polymorphic_allocator<char16_t>>;
+        using StringTemplateU32 [[maybe_unused]] =
+                BasicStringTemplate<char32_t, std::pmr::polymorphic_allocator<char32_t>>;
+        using StringTemplateW [[maybe_unused]] =
+                BasicStringTemplate<wchar_t, std::pmr::polymorphic_allocator<wchar_t>>;
+        using RenderedBatchU8 [[maybe_unused]] =
+                BasicRenderedBatch<char8_t, std::pmr::polymorphic_allocator<char8_t>>;
+        using RenderedBatchU16 [[maybe_unused]] =
+                BasicRenderedBatch<char16_t, std::pmr::polymorphic_allocator<char16_t>>;
+        using RenderedBatchU32 [[maybe_unused]] =
+                BasicRenderedBatch<char32_t, std::pmr::polymorphic_allocator<char32_t>>;
+        using RenderedBatchW [[maybe_unused]] =
+                BasicRenderedBatch<wchar_t, std::pmr::polymorphic_allocator<wchar_t>>;
+        using KeySubstitutionU8 [[maybe_unused]] =
+                BasicKeySubstitution<char8_t, std::pmr::polymorphic_allocator<char8_t>>;
+        using KeySubstitutionU16 [[maybe_unused]] =
+                BasicKeySubstitution<char16_t, std::pmr::polymorphic_allocator<char16_t>>;
+        using KeySubstitutionU32 [[maybe_unused]] =
+                BasicKeySubstitution<char32_t, std::pmr::polymorphic_allocator<char32_t>>;
+        using KeySubstitutionW [[maybe_unused]] =
+                BasicKeySubstitution<wchar_t, std::pmr::polymorphic_allocator<wchar_t>>;
+        using ValidationReportU8 [[maybe_unused]] =
+                BasicValidationReport<char8_t, std::pmr::polymorphic_allocator<char8_t>>;
+        using ValidationReportU16 [[maybe_unused]] =
+                BasicValidationReport<char16_t, std::pmr::polymorphic_allocator<char16_t>>;
+        using ValidationReportU32 [[maybe_unused]] =
+                BasicValidationReport<char32_t, std::pmr::polymorphic_allocator<char32_t>>;
+        using ValidationReportW [[maybe_unused]] =
+                BasicValidationReport<wchar_t, std::pmr::polymorphic_allocator<wchar_t>>;
+        using TemplateBundleWriterU8 [[maybe_unused]] =
+                BasicTemplateBundleWriter<char8_t, std::pmr::polymorphic_allocator<char8_t>>;
+        using TemplateBundleWriterU16 [[maybe_unused]] =
+                BasicTemplateBundleWriter<char16_t, std::pmr::polymorphic_allocator<char16_t>>;
+        using TemplateBundleWriterU32 [[maybe_unused]] =
+                BasicTemplateBundleWriter<char32_t, std::pmr::polymorphic_allocator<char32_t>>;
+        using TemplateBundleWriterW [[maybe_unused]] =
+                BasicTemplateBundleWriter<wchar_t, std::pmr::polymorphic_allocator<wchar_t>>;
+        using TemplateBundleU8 [[maybe_unused]] =
+                BasicTemplateBundle<char8_t, std::pmr::polymorphic_allocator<char8_t>>;
+        using TemplateBundleU16 [[maybe_unused]] =
+                BasicTemplateBundle<char16_t, std::pmr::polymorphic_allocator<char16_t>>;
+        using TemplateBundleU32 [[maybe_unused]] =
+                BasicTemplateBundle<char32_t, std::pmr::polymorphic_allocator<char32_t>>;
+        using TemplateBundleW [[maybe_unused]] =
+                BasicTemplateBundle<wchar_t, std::pmr::polymorphic_allocator<wchar_t>>;
+        using TemplateViewU8 [[maybe_unused]] =
+                BasicTemplateView<char8_t, std::pmr::polymorphic_allocator<char8_t>>;
+        using TemplateViewU16 [[maybe_unused]] =
+                BasicTemplateView<char16_t, std::pmr::polymorphic_allocator<char16_t>>;
+        using TemplateViewU32 [[maybe_unused]] =
+                BasicTemplateView<char32_t, std::pmr::polymorphic_allocator<char32_t>>;
+        using TemplateViewW [[maybe_unused]] =
+                BasicTemplateView<wchar_t, std::pmr::polymorphic_allocator<wchar_t>>;
+        using StringInterpolationU8 [[maybe_unused]] =
+                BasicStringInterpolation<char8_t, std::pmr::polymorphic_allocator<char8_t>>;
+        using StringInterpolationU16 [[maybe_unused]] =
+                BasicStringInterpolation<char16_t, std::pmr::polymorphic_allocator<char16_t>>;
+        using StringInterpolationU32 [[maybe_unused]] =
+                BasicStringInterpolation<char32_t, std::pmr::polymorphic_allocator<char32_t>>;
+        using StringInterpolationW [[maybe_unused]] =
+                BasicStringInterpolation<wchar_t, std::pmr::polymorphic_allocator<wchar_t>>;
+#endif
+    } // namespace pmr
+
 } // namespace istr
 
 #endif // STRING_INTERPOLATION_H
\ No newline at end of file
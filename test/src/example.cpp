@@ -1,7 +1,10 @@
+#include <cassert>
 #include <iostream>
 #include "../../include/string_interpolation.hpp"
 #include <chrono>
 #include <ctime>
+#include <memory_resource>
+#include <sstream>
 
 template<istr::CharTypes T>
 void print_test(const istr::BasicStringInterpolation<T> &stringInterpolation, const std::string &type)
@@ -44,8 +47,8 @@ int main(){
     const istr::StringInterpolation stringInterpolation1(" current time is  {{time}}");
     //by default is using as open delimiter "{{" and  as close delimiter "}}"
 
-    stringInterpolation1.putPatternArgument("time",now());
-    // or
+    stringInterpolation1.putPatternArgumentProvider("time", now);
+    // the provider is called only while substituting and only if the pattern contains {{time}}, or
     // stringInterpolation.putPatternArgument("{{time}}",now());
 
     istr::StringInterpolation stringInterpolation2 = istr::StringInterpolation("--1)) --2)) --3))");
@@ -63,21 +66,43 @@ int main(){
                                          {"--3))","three"}});
      */
 
+    // with the same open and close delimiter a stray delimiter stays literal text
+    istr::StringInterpolation stringInterpolation6("Hello --name-- -- see --id--", "--", "--");
+    stringInterpolation6.putPatternArguments({{"name", "Harry"}, {"id", "42"}});
+    assert(stringInterpolation6.getSubstituted() == "Hello Harry -- see 42");
+    assert(istr::StringTemplate("Hello --name-- -- see --id--", "--", "--").render({{"name", "Harry"}, {"id", "42"}}) ==
+           "Hello Harry -- see 42");
+    istr::StringInterpolation stringInterpolation7("----c--", "--", "--");
+    stringInterpolation7.putPatternArgument("c", "C");
+    assert(stringInterpolation7.getSubstituted() == "--C");
+    assert(istr::StringTemplate("----c--", "--", "--").render({{"c", "C"}}) == "--C");
+    // the interpolation, the template and the stream pair identical delimiters alike
+    for (const std::string pattern: {"--a-- --b--", "-- --a--", "----a----b--", "--a b-- --a--", "--a--b--", "------",
+                                     "--a", "-- a --b--", "--a----b----", "--x--b--"}) {
+        istr::StringInterpolation interpolation(pattern, "--", "--");
+        interpolation.putPatternArguments({{"a", "A"}, {"b", "B"}});
+        const std::string rendered = istr::StringTemplate(pattern, "--", "--").render({{"a", "A"}, {"b", "B"}});
+        std::string streamedPattern;
+        istr::StreamSubstitution({{"a", "A"}, {"b", "B"}}, "--", "--").substitute(pattern, [&](std::string_view fragment) {
+            streamedPattern += fragment;
+        });
+        assert(interpolation.getSubstituted() == rendered && streamedPattern == rendered);
+    }
+
     print_test(stringInterpolation,"StringInterpolation");
     print_test(stringInterpolation1,"StringInterpolation");
     print_test(stringInterpolation2,"StringInterpolation");
 
-    //    istr::StringInterpolation stringInterpolation3 = istr::StringInterpolation("test for optimization {{tests}}");
-    //
-    //    std::cout<<stringInterpolation3.getSubstituted()<<std::endl;
+    // validation does not throw or print, the problems are reported by validate() and getValidationReport(),
+    // or passed to a callback set with setValidationCallback() once every time the pattern or arguments change
+    istr::StringInterpolation stringInterpolation3("test for validation {{tests}}");
+    stringInterpolation3.setValidationCallback([](const istr::ValidationReport& report) {
+        std::cout << "validation error : " << static_cast<int>(report.getResult().error()) << std::endl;
+    });
+    std::cout << stringInterpolation3.getSubstituted() << std::endl;
+    // ValidationErrors::NO_ARGUMENTS because no arguments were added to replace the placeholders
 
-    // in this case you will recive error
-    //
-    //  " has no arguments to replace in pattern, cannot do substitution string"
-    // because you don't add arguments for replace them in pattern and create substition
-    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
-
-    // but you can use " Modes::WITHOUT_REPLACEMENT_VALIDATION " for diabled substition validation,
+    // you can use " Modes::WITHOUT_REPLACEMENT_VALIDATION " for diabled substition validation,
     // in this case, the responsibility rests with you, you must follow which pattern you inserted and which arguments you added
 
     istr::StringInterpolation stringInterpolation4 = istr::StringInterpolation("test for optimization {{tests}}",
@@ -90,5 +115,113 @@ int main(){
 
     std::cout << stringInterpolation5.getSubstituted()<<std::endl;
 
+    // a pattern known at compile time is parsed by the compiler, a missing or misspelled argument is a compile error
+    using UserTemplate = istr::FixedTemplate<"user {{name}} id {{id}}">;
+    std::cout << UserTemplate::render(istr::fixedArgument<"name">("Harry"),
+                                      istr::fixedArgument<"id">("42")) << std::endl;
+
+    // a compiled template is immutable, one instance can be shared by many threads,
+    // the arguments are bound per render call, by name or by full placeholder
+    const std::shared_ptr<const istr::StringTemplate> greeting = std::make_shared<const istr::StringTemplate>("hello {{name}}");
+    std::cout << greeting->render({{"name", "Ron"}}) << std::endl;
+    std::cout << greeting->render({{"{{name}}", "Hermione"}}) << std::endl;
+
+    // a template cache compiles every pattern once, a full cache evicts the first entry not used since its
+    // clock hand last passed, a template still in use outlives its eviction
+    istr::StringTemplateCache cache(2);
+    const std::shared_ptr<const istr::StringTemplate> cachedGreeting = cache.get("hi {{name}}", "{{", "}}");
+    assert(cache.get("hi {{name}}", "{{", "}}") == cachedGreeting);
+    cache.get("bye {{name}}", "{{", "}}");
+    cache.get("see you {{name}}", "{{", "}}");
+    const istr::TemplateCacheStatistics statistics = cache.getStatistics();
+    assert(statistics.hits == 1 && statistics.misses == 3 && statistics.evictions == 1 && statistics.size == 2);
+    assert(cache.get("hi {{name}}", "{{", "}}") != cachedGreeting);
+    assert(cachedGreeting->render({{"name", "Hagrid"}}) == "hi Hagrid");
+
+    // a stream is substituted chunk by chunk, a delimiter or placeholder split between chunks is kept back
+    // until the next chunk arrives
+    istr::StreamSubstitution streamSubstitution({{"name", "Sirius"}, {"house", "Gryffindor"}});
+    std::string streamed;
+    const auto sink = [&streamed](std::string_view fragment) {
+        streamed += fragment;
+    };
+    for (const std::string_view chunk: {"dear {", "{na", "me}", "} of {{house}", "} {", "{unknown}} {"}) {
+        streamSubstitution.feed(chunk, sink);
+    }
+    streamSubstitution.finish(sink);
+    assert(streamed == "dear Sirius of Gryffindor {{unknown}} {");
+
+    // putting a placeholder again replaces its value, the next substitution only writes the changed placeholders
+    // again and matches a fresh render of the same arguments
+    istr::StringInterpolation stringInterpolation9("{{name}} has {{count}} owls, {{name}} says");
+    stringInterpolation9.putPatternArguments({{"name", "Harry"}, {"count", "1"}});
+    assert(stringInterpolation9.getSubstituted() == "Harry has 1 owls, Harry says");
+    stringInterpolation9.putPatternArgument("count", "2");
+    assert(stringInterpolation9.getSubstituted() == "Harry has 2 owls, Harry says");
+    stringInterpolation9.putPatternArgument("name", "Hermione");
+    stringInterpolation9.putPatternArgument("count", "12");
+    assert(stringInterpolation9.getSubstituted() ==
+           istr::StringTemplate(stringInterpolation9.getPattern()).render(stringInterpolation9.getPatternArguments()));
+    assert(stringInterpolation9.getSubstituted() == "Hermione has 12 owls, Hermione says");
+
+    // literal keys are substituted in one pass, the leftmost key wins, among keys starting at the same position
+    // the longest one, and replacements are not scanned again
+    const istr::KeySubstitution keySubstitution({{"he", "1"}, {"she", "2"}, {"hers", "3"}, {"KEY", "k"}, {"KEYS", "ks"},
+                                                 {"a", "b"}, {"b", "c"}});
+    assert(keySubstitution.substitute("ushers") == "u2rs");
+    assert(keySubstitution.substitute("hers and he") == "3 bnd 1");
+    assert(keySubstitution.substitute("KEY KEYS") == "k ks");
+    assert(keySubstitution.substitute("ab") == "bc");
+
+    // the fragments view the literals of the pattern and the argument values in order, nothing is copied
+    // until they are written, renderTo() writes them straight to a stream
+    istr::StringInterpolation stringInterpolation8("from {{from}} to {{to}}");
+    stringInterpolation8.putPatternArguments({{"from", "Hogwarts"}, {"to", "London"}});
+    const istr::StringInterpolation::Fragments fragments = stringInterpolation8.getSubstitutedFragments();
+    assert(fragments.size() == 4 && fragments[1] == "Hogwarts" && fragments[3] == "London");
+    std::string joined;
+    for (const std::string_view fragment: fragments) {
+        joined += fragment;
+    }
+    assert(joined == stringInterpolation8.getSubstituted());
+    std::ostringstream stream;
+    greeting->renderTo(stream, {{"name", "Dobby"}});
+    assert(stream.str() == "hello Dobby");
+
+    // a batch renders many rows into one arena, from a row per argument map or from a column per placeholder,
+    // columns the template does not reference are ignored, the parallel mode splits the rows between threads
+    const std::vector<istr::StringTemplate::Arguments> rows{{{"name", "Ginny"}}, {{"name", "Fred"}}};
+    const istr::RenderedBatch rowBatch = greeting->renderBatch(rows);
+    assert(rowBatch.getSize() == 2 && rowBatch[0] == "hello Ginny" && rowBatch[1] == "hello Fred");
+    istr::StringTemplate::Columns columns{{"name", {}}, {"unused", {"x"}}};
+    for (int row = 0; row < 1000; ++row) {
+        columns["name"].push_back(std::to_string(row));
+    }
+    const istr::RenderedBatch columnBatch = greeting->renderBatch(columns);
+    const istr::RenderedBatch parallelBatch = greeting->renderBatch(columns, istr::BatchExecutionModes::PARALLEL);
+    assert(columnBatch.getSize() == 1000 && columnBatch[999] == "hello 999");
+    assert(parallelBatch.getArena() == columnBatch.getArena() && parallelBatch.getOffsets() == columnBatch.getOffsets());
+
+    // typed arguments are formatted straight into the output, without temporary strings
+    const istr::StringTemplate logLine("[{{time}}] request {{id}} took {{elapsed}}");
+    std::cout << logLine.render(istr::argument("time", std::chrono::system_clock::now()),
+                                istr::argument("id", 42),
+                                istr::argument("elapsed", std::chrono::milliseconds(17))) << std::endl;
+
+    // compiled templates are composed without parsing them again, the partial is shared and not copied
+    const auto signature = std::make_shared<const istr::StringTemplate>("\n-- {{sender}}");
+    const istr::StringTemplate letter("{{greeting}} {{name}}{{signature}}", "{{", "}}", {{"signature", signature}});
+    std::cout << letter.render({{"greeting", "Hi"}, {"name", "Luna"}, {"sender", "Neville"}}) << std::endl;
+
+    // the pmr variants keep the pattern, the arguments and the substitution on a caller supplied memory resource,
+    // everything allocated for the request is released at once with the arena
+    std::pmr::monotonic_buffer_resource requestArena;
+    istr::pmr::StringInterpolation response(istr::pmr::StringInterpolation::String("goodbye {{name}}", &requestArena),
+                                            istr::SubstitutionPreparationModes::WITHOUT_REPLACEMENT_VALIDATION,
+                                            &requestArena);
+    response.putPatternArgument(istr::pmr::StringInterpolation::String("name", &requestArena),
+                                istr::pmr::StringInterpolation::String("Draco", &requestArena));
+    std::cout << response.getSubstituted() << std::endl;
+
     return 0;
 }
@@ -0,0 +1,42 @@
+#include <cassert>
+#include <iostream>
+// counts the renders and calls the render hooks, without it the instrumentation does not exist
+#define STRING_INTERPOLATION_ENABLE_INSTRUMENTATION
+#include "../../include/string_interpolation.hpp"
+#include <numeric>
+
+int main(){
+    // every render is counted per interpolation and process wide and seen by the installed hooks,
+    // a substitution returned unchanged counts as a cache hit
+    struct Trace {
+        std::size_t begins = 0;
+        std::size_t ends = 0;
+        std::size_t bytes = 0;
+    } trace;
+    const istr::RenderHooks hooks{
+            [](const istr::RenderEvent&, void* context) {
+                ++static_cast<Trace*>(context)->begins;
+            },
+            [](const istr::RenderEvent& event, void* context) {
+                ++static_cast<Trace*>(context)->ends;
+                static_cast<Trace*>(context)->bytes += event.bytes;
+            },
+            &trace};
+    istr::RenderHooks::setGlobal(&hooks);
+    istr::StringInterpolation stringInterpolation10("owl {{number}}");
+    stringInterpolation10.putPatternArgument("number", "42");
+    stringInterpolation10.getSubstituted();
+    stringInterpolation10.getSubstituted();
+    stringInterpolation10.putPatternArgument("number", "43");
+    stringInterpolation10.getSubstituted();
+    istr::RenderHooks::setGlobal(nullptr);
+    const istr::RenderStatistics renderStatistics = stringInterpolation10.getRenderCounters().getStatistics();
+    assert(renderStatistics.renders == 2 && renderStatistics.cacheHits == 1 && renderStatistics.bytes == 12);
+    assert(std::accumulate(renderStatistics.latencyHistogram.begin(), renderStatistics.latencyHistogram.end(),
+                           std::uint64_t(0)) == renderStatistics.renders);
+    assert(trace.begins == 2 && trace.ends == 2 && trace.bytes == 12);
+    assert(istr::RenderCounters::getGlobal().getStatistics().renders >= renderStatistics.renders);
+    std::cout << "renders : " << renderStatistics.renders << ", cache hits : " << renderStatistics.cacheHits << std::endl;
+
+    return 0;
+}